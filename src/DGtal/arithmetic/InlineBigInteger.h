@@ -0,0 +1,521 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file InlineBigInteger.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module InlineBigInteger.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(InlineBigInteger_RECURSES)
+#error Recursive header files inclusion detected in InlineBigInteger.h
+#else // defined(InlineBigInteger_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define InlineBigInteger_RECURSES
+
+#if !defined InlineBigInteger_h
+/** Prevents repeated inclusion of headers. */
+#define InlineBigInteger_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <functional>
+#include <type_traits>
+#include <boost/functional/hash.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/ArithmeticConversionTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+// InlineBigInteger needs GMP for large values and a compiler
+// providing 128-bit integers (gcc, clang) for small ones.
+#if defined(WITH_BIGINTEGER) && defined(__SIZEOF_INT128__)
+#define WITH_INLINE_BIGINTEGER
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class InlineBigInteger
+  /**
+   * Description of class 'InlineBigInteger' <p>
+   * \brief Aim: An arbitrary-size integer which stores its value
+   * inline, as a 128-bit integer, as long as it is small enough, and
+   * falls back to a heap-allocated BigInteger (GMP) otherwise.
+   *
+   * Exact computations in IntegerComputer, LatticePolytope2D or
+   * COBANaivePlaneComputer need more than 64 bits for large
+   * diameters, but their values rarely exceed 128 bits. With
+   * BigInteger, each temporary costs a heap allocation, while
+   * arithmetic operations on InlineBigInteger only check for overflow
+   * (with compiler builtins) as long as operands and result fit in
+   * 128 bits. Results of operations falling back to GMP are stored
+   * inline again whenever they fit.
+   *
+   * Division and modulo are truncated toward zero, like for
+   * fundamental integers and BigInteger.
+   *
+   * Model of concepts::CInteger (see NumberTraits<InlineBigInteger>).
+   *
+   * @code
+   * typedef COBANaivePlaneComputer< Z3i::Space, InlineBigInteger > NaivePlaneComputer;
+   * @endcode
+   *
+   * @note Only available when DGtal is built with GMP and when the
+   * compiler supports 128-bit integers (WITH_INLINE_BIGINTEGER is
+   * then defined).
+   */
+  class InlineBigInteger
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef InlineBigInteger Self;
+    /// The type of inline values.
+    __extension__ typedef __int128 SmallInteger;
+
+    /// Default constructor, the value is zero.
+    InlineBigInteger();
+
+    /**
+     * Constructor from any fundamental integer.
+     * @tparam TInteger any integral type.
+     * @param x the value.
+     */
+    template <typename TInteger>
+    InlineBigInteger( TInteger x,
+                      typename std::enable_if< std::is_integral<TInteger>::value >::type* = 0 );
+
+    /**
+     * Constructor from a BigInteger.
+     * @param x the value.
+     */
+    InlineBigInteger( const BigInteger & x );
+
+    /**
+     * Constructor from a floating-point number (truncated).
+     * @param x the value.
+     */
+    explicit InlineBigInteger( double x );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    InlineBigInteger( const Self & other );
+
+    /**
+     * Move constructor.
+     * @param other the object to move.
+     */
+    InlineBigInteger( Self && other ) noexcept;
+
+    /// Destructor.
+    ~InlineBigInteger();
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other );
+
+    /**
+     * Move assignment.
+     * @param other the object to move.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( Self && other ) noexcept;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return 'true' if the value is stored inline.
+    bool isInline() const;
+
+    /// @return the value as a BigInteger.
+    BigInteger toBigInteger() const;
+
+    /// @return the least significant bits of the value, as get_si().
+    DGtal::int64_t toInt64() const;
+
+    /// @return the value converted to a double.
+    double toDouble() const;
+
+    /// @return -1, 0 or 1 according to the sign of the value.
+    int sign() const;
+
+    /// @return 'true' iff the value is even.
+    bool even() const;
+
+    /// @return the value converted to a double.
+    explicit operator double() const;
+
+    /// @return the least significant bits of the value.
+    explicit operator DGtal::int64_t() const;
+
+    /// @return the least significant bits of the value.
+    explicit operator int() const;
+
+    /// @return the opposite of the value.
+    Self operator-() const;
+    /// @return a copy of the value.
+    Self operator+() const;
+
+    /// Pre-increment. @return a reference on 'this'.
+    Self & operator++();
+    /// Pre-decrement. @return a reference on 'this'.
+    Self & operator--();
+    /// Post-increment. @return the former value.
+    Self operator++( int );
+    /// Post-decrement. @return the former value.
+    Self operator--( int );
+
+    /// Addition. @param b any integer. @return a reference on 'this'.
+    Self & operator+=( const Self & b );
+    /// Subtraction. @param b any integer. @return a reference on 'this'.
+    Self & operator-=( const Self & b );
+    /// Multiplication. @param b any integer. @return a reference on 'this'.
+    Self & operator*=( const Self & b );
+    /// Truncated division. @param b any non-zero integer. @return a reference on 'this'.
+    Self & operator/=( const Self & b );
+    /// Remainder of the truncated division. @param b any non-zero integer. @return a reference on 'this'.
+    Self & operator%=( const Self & b );
+
+    friend Self operator+( const Self & a, const Self & b );
+    friend Self operator-( const Self & a, const Self & b );
+    friend Self operator*( const Self & a, const Self & b );
+    friend Self operator/( const Self & a, const Self & b );
+    friend Self operator%( const Self & a, const Self & b );
+
+    friend bool operator==( const Self & a, const Self & b );
+    friend bool operator!=( const Self & a, const Self & b );
+    friend bool operator<( const Self & a, const Self & b );
+    friend bool operator<=( const Self & a, const Self & b );
+    friend bool operator>( const Self & a, const Self & b );
+    friend bool operator>=( const Self & a, const Self & b );
+
+    /**
+     * Compares two integers.
+     * @param a any integer.
+     * @param b any integer.
+     * @return a negative, zero or positive number if a < b, a == b or a > b.
+     */
+    static int compare( const Self & a, const Self & b );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The value, when it is stored inline.
+    SmallInteger mySmall;
+    /// The value, when it does not fit in a SmallInteger (0 otherwise).
+    BigInteger* myBig;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The unsigned type of the magnitude of inline values.
+    __extension__ typedef unsigned __int128 UnsignedSmallInteger;
+
+    /// Tag for the constructor from an inline value.
+    struct SmallTag {};
+
+    /**
+     * Constructor from an inline value.
+     * @param x the value.
+     */
+    InlineBigInteger( SmallInteger x, SmallTag );
+
+    /**
+     * Sets the value, inline if it fits in a SmallInteger.
+     * @param z the value.
+     */
+    void setBig( const BigInteger & z );
+
+    /**
+     * @param tmp a temporary used if the value is inline.
+     * @return the value as a BigInteger.
+     */
+    const BigInteger & big( BigInteger & tmp ) const;
+
+    /**
+     * Converts an inline value to a BigInteger.
+     * @param[out] z the BigInteger.
+     * @param x the value.
+     */
+    static void toBig( BigInteger & z, SmallInteger x );
+
+    /**
+     * Converts a BigInteger to an inline value, if possible.
+     * @param z the BigInteger.
+     * @param[out] x the value.
+     * @return 'true' if the value fits in a SmallInteger.
+     */
+    static bool toSmall( const BigInteger & z, SmallInteger & x );
+
+    /// @return the smallest inline value, -2^127.
+    static SmallInteger smallMin();
+
+    /**
+     * @param z any BigInteger.
+     * @return the corresponding InlineBigInteger.
+     */
+    static Self fromBig( const BigInteger & z );
+
+  }; // end of class InlineBigInteger
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'InlineBigInteger'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'InlineBigInteger' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const InlineBigInteger & object );
+
+  /**
+   * Overloads 'operator>>' for reading objects of class 'InlineBigInteger'.
+   * @param in the input stream.
+   * @param object the object of class 'InlineBigInteger' to read.
+   * @return the input stream after the reading.
+   */
+  std::istream&
+  operator>> ( std::istream & in, InlineBigInteger & object );
+
+
+  /** @brief Specialization of NumberTraitsImpl for DGtal::InlineBigInteger
+   *
+   * Like DGtal::BigInteger, DGtal::InlineBigInteger represents
+   * signed and unsigned arbitrary-size integers. Therefore both
+   * IsUnsigned and IsSigned are TagTrue.
+   */
+  template <typename Enable>
+  struct NumberTraitsImpl<DGtal::InlineBigInteger, Enable>
+  {
+    typedef TagTrue IsIntegral;     ///< An InlineBigInteger is of integral type.
+    typedef TagFalse IsBounded;     ///< An InlineBigInteger is not bounded.
+    typedef TagTrue IsUnsigned;     ///< An InlineBigInteger can be signed and unsigned.
+    typedef TagTrue IsSigned;       ///< An InlineBigInteger can be signed and unsigned.
+    typedef TagTrue IsSpecialized;  ///< Is that a number type with specific traits.
+
+    typedef DGtal::InlineBigInteger SignedVersion;    ///< Alias to the signed version of an InlineBigInteger (aka an InlineBigInteger).
+    typedef DGtal::InlineBigInteger UnsignedVersion;  ///< Alias to the unsigned version of an InlineBigInteger (aka an InlineBigInteger).
+    typedef DGtal::InlineBigInteger ReturnType;       ///< Alias to the type that should be used as return type.
+
+    /** @brief Defines a type that represents the "best" way to pass
+     *  a parameter of type T to a function.
+     */
+    typedef typename boost::call_traits<InlineBigInteger>::param_type ParamType;
+
+    /// Constant Zero.
+    static const DGtal::InlineBigInteger ZERO;
+
+    /// Constant One.
+    static const DGtal::InlineBigInteger ONE;
+
+    /// Return the zero of this integer.
+    static inline
+    ReturnType zero() noexcept
+    {
+      return ZERO;
+    }
+
+    /// Return the one of this integer.
+    static inline
+    ReturnType one() noexcept
+    {
+      return ONE;
+    }
+
+    /// Return the minimum possible value (trigger an error since InlineBigInteger is unbounded).
+    static inline
+    ReturnType min() noexcept
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support min() function");
+      return ZERO;
+    }
+
+    /// Return the maximum possible value (trigger an error since InlineBigInteger is unbounded).
+    static inline
+    ReturnType max() noexcept
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support max() function");
+      return ZERO;
+    }
+
+    /// Return the number of significant binary digits (trigger an error since InlineBigInteger is unbounded).
+    static inline
+    unsigned int digits() noexcept
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support digits() function");
+      return 0;
+    }
+
+    /** @brief Return the bounding type of the number.
+     *
+     * @return BOUNDED, UNBOUNDED, or BOUND_UNKNOWN.
+     */
+    static inline
+    BoundEnum isBounded() noexcept
+    {
+      return UNBOUNDED;
+    }
+
+    /** @brief Return the sign type of the number.
+     *
+     * @return SIGNED, UNSIGNED or SIGN_UNKNOWN.
+     */
+    static inline
+    SignEnum isSigned() noexcept
+    {
+      return SIGNED;
+    }
+
+    /** @brief
+     * Cast method to DGtal::int64_t (for I/O or board export uses
+     * only).
+     */
+    static inline
+    DGtal::int64_t castToInt64_t(const DGtal::InlineBigInteger & aT) noexcept
+    {
+      return aT.toInt64();
+    }
+
+    /** @brief
+     * Cast method to double (for I/O or board export uses
+     * only).
+     */
+    static inline
+    double castToDouble(const DGtal::InlineBigInteger & aT) noexcept
+    {
+      return aT.toDouble();
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is even.
+     */
+    static inline
+    bool even( ParamType aT ) noexcept
+    {
+      return aT.even();
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is odd.
+     */
+    static inline
+    bool odd( ParamType aT ) noexcept
+    {
+      return ! aT.even();
+    }
+  }; // end of class NumberTraits<DGtal::InlineBigInteger>.
+
+  // Definition of the static attributes in order to allow ODR-usage.
+  template <typename Enable> const DGtal::InlineBigInteger NumberTraitsImpl<DGtal::InlineBigInteger, Enable>::ZERO = 0;
+  template <typename Enable> const DGtal::InlineBigInteger NumberTraitsImpl<DGtal::InlineBigInteger, Enable>::ONE  = 1;
+
+  /** @brief Specialization when first operand is an @ref InlineBigInteger.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T>
+  struct ArithmeticConversionTraits<T, DGtal::InlineBigInteger,
+      typename std::enable_if< std::is_integral<T>::value >::type >
+  {
+    using type = DGtal::InlineBigInteger;
+  };
+
+  /** @brief Specialization when second operand is an @ref InlineBigInteger.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename U>
+  struct ArithmeticConversionTraits<DGtal::InlineBigInteger, U,
+      typename std::enable_if< std::is_integral<U>::value >::type >
+  {
+    using type = DGtal::InlineBigInteger;
+  };
+
+  /** @brief Specialization when both operands are @ref InlineBigInteger.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <>
+  struct ArithmeticConversionTraits<DGtal::InlineBigInteger, DGtal::InlineBigInteger>
+  {
+    using type = DGtal::InlineBigInteger;
+  };
+
+} // namespace DGtal
+
+
+namespace std
+{
+  /// Hash function of DGtal::InlineBigInteger (e.g. for hashing points).
+  template <>
+  struct hash< DGtal::InlineBigInteger >
+  {
+    size_t operator()(const DGtal::InlineBigInteger & p) const
+    {
+      return static_cast<size_t>( DGtal::NumberTraits<DGtal::InlineBigInteger>::castToInt64_t( p ) );
+    }
+  };
+}
+//Also defining boost::hash since boost::hash_range needs it.
+namespace boost
+{
+  template <>
+  struct hash< DGtal::InlineBigInteger > : std::hash<DGtal::InlineBigInteger>
+  { };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/InlineBigInteger.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // defined(WITH_BIGINTEGER) && defined(__SIZEOF_INT128__)
+
+#endif // !defined InlineBigInteger_h
+
+#undef InlineBigInteger_RECURSES
+#endif // else defined(InlineBigInteger_RECURSES)
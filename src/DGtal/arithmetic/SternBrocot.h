@@ -44,6 +44,8 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <atomic>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -67,6 +69,14 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree may be expanded concurrently by several threads: a new
+   pair of descendants is published atomically in its parent, and
+   the loser of a race simply uses the nodes of the winner. Nodes are
+   allocated in blocks owned by the calling thread, and are all freed
+   when the tree is destroyed at program exit. Besides, each thread
+   keeps a small cache of the fractions recently returned by
+   SternBrocot::fraction.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -130,9 +140,9 @@ namespace DGtal
       /// the node that is the right ascendant.
       Node* ascendantRight;
       /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
+      std::atomic<Node*> descendantLeft;
       /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
     };
@@ -163,6 +173,7 @@ namespace DGtal
 
     private:
       Node* myNode; 
+      friend class SternBrocot<TInteger,TQuotient>;
 
     public:
       /** 
@@ -457,14 +468,36 @@ namespace DGtal
     bool isValid() const;
 
     /// The total number of fractions in the current tree.
-    Quotient nbFractions;
+    std::atomic<std::size_t> nbFractions;
 
     // ------------------------- Protected Datas ------------------------------
   private:
+    /**
+       A block of nodes, filled by a single thread. Blocks are chained
+       so that the tree can free all its nodes at destruction.
+    */
+    struct NodeBlock {
+      /// The number of nodes stored in a block.
+      static std::size_t capacity() { return 512; }
+      /// Constructor.
+      NodeBlock();
+      /// Destructor. Destroys the constructed nodes.
+      ~NodeBlock();
+      /// @return the address of the node at position \a i.
+      Node* node( std::size_t i );
+
+      /// the next block in the list of blocks of the tree.
+      NodeBlock* next;
+      /// the number of constructed nodes.
+      std::size_t size;
+      /// the storage of the nodes.
+      typename std::aligned_storage< sizeof( Node ), alignof( Node ) >::type* storage;
+    };
+
     // ------------------------- Private Datas --------------------------------
   private:
-    /// Singleton class.
-    static SternBrocot* singleton;
+    /// The list of blocks of nodes, freed at destruction.
+    std::atomic<NodeBlock*> myBlocks;
 
     Node* myZeroOverOne;
     Node* myOneOverZero;
@@ -496,6 +529,27 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// @return the block in which the calling thread allocates its nodes.
+    static NodeBlock*& currentBlock();
+
+    /**
+       Allocates a node in the block of the calling thread (see Node::Node).
+       @return the new node.
+    */
+    Node* newNode( Integer p1, Integer q1, Quotient u1, Quotient k1,
+                   Node* ascendant_left1, Node* ascendant_right1,
+                   Node* descendant_left1, Node* descendant_right1,
+                   Node* inverse1 );
+
+    /**
+       Gives back a node that has never been published in the tree
+       (e.g. when another thread created the same descendant first).
+       Its memory is reused if it is the last node allocated by the
+       calling thread.
+       @param n a node returned by newNode.
+    */
+    void discardNode( Node* n );
+
   }; // end of class SternBrocot
 
 
@@ -168,6 +168,13 @@ namespace DGtal
     typedef std::vector<SCell> SCells;
     typedef boost::array<SCells, dimEmbedded+1> IndexedSCells;
 
+    /**
+     * Indices to cells properties typedefs.
+     * Flat storage of cell properties, in index order, used for operator assembly.
+     */
+    typedef std::vector<Property> FlatProperties;
+    typedef boost::array<FlatProperties, dimEmbedded+1> IndexedProperties;
+
     /**
      * Vector field typedefs.
      */
@@ -329,7 +336,10 @@ namespace DGtal
 
     /**
      * Update indexes for all cells.
-     * Cell insertion order == index may not be preserved.
+     * Cell insertion order == index may not be preserved:
+     * cells of each order are indexed following the cell ordering, which
+     * makes indexes independent of the hash map layout and keeps
+     * neighboring cells close in k-form containers.
      */
     void
     updateIndexes();
@@ -351,6 +361,17 @@ namespace DGtal
     const SCells&
     getIndexedSCells() const;
 
+    /**
+     * Get all cells properties with specific @a order and @a duality in index order.
+     * Allows to access cell properties from k-form index without any cell lookup.
+     * @tparam order order of cells.
+     * @tparam duality duality of cells.
+     * @return index ordered cells properties.
+     */
+    template <Order order, Duality duality>
+    const FlatProperties&
+    getIndexedProperties() const;
+
     /**
      * Reorder operator from _order_-forms to _order_-forms.
      * Reorder indexes from internal index order to iterator range traversal induced order.
@@ -558,6 +579,13 @@ namespace DGtal
      */
     IndexedSCells myIndexSignedCells;
 
+    /**
+     * Cells properties indexed by their order.
+     * Mirrors myCellProperties in index order, so that operator
+     * assembly does not need to hash cells whose index is known.
+     */
+    IndexedProperties myIndexProperties;
+
     /**
      * Cached flat operator matrix.
      */
@@ -607,6 +635,30 @@ namespace DGtal
     void
     updateSharpOperator();
 
+    /**
+     * Number of triplets buffers used when assembling operators.
+     * Equals the maximum number of OpenMP threads when DGtal is built
+     * with OpenMP support, 1 otherwise.
+     */
+    static std::size_t
+    assemblyThreadCount();
+
+    /**
+     * Index of the triplets buffer of the calling thread.
+     */
+    static std::size_t
+    assemblyThreadIndex();
+
+    /**
+     * Concatenate per thread triplets buffers into a single one.
+     * @tparam TTriplets triplets container type.
+     * @param triplets_per_thread triplets buffers, one per thread.
+     * @return all triplets.
+     */
+    template <typename TTriplets>
+    static TTriplets
+    mergeTriplets(std::vector<TTriplets>& triplets_per_thread);
+
   }; // end of class DiscreteExteriorCalculus
 
 
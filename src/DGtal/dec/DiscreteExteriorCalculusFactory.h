@@ -160,6 +160,22 @@ protected:
     void
     accumulateAllLowerIncidentCells(const KSpace& kspace, const typename CellsAccum::key_type& cell, CellsAccum& cells_accum);
 
+    /**
+     * Insert recursively all lower incident cells into cells vector, starting from cell.
+     * Cells are pushed once per incidence path, so that counting equal cells in the sorted vector
+     * gives the same counts as accumulateAllLowerIncidentCells, without any associative container.
+     * Internal use only.
+     * @tparam KSpace Khalimsky space type.
+     * @tparam CellsVector cells vector type, should be similar to std::vector<KSpace::Cell>.
+     * @param kspace Khalimsky space instance.
+     * @param cell starting cell.
+     * @param cells_vector cells vector in which lower incident cells get pushed.
+     */
+    template <typename KSpace, typename CellsVector>
+    static
+    void
+    collectAllLowerIncidentCells(const KSpace& kspace, const typename CellsVector::value_type& cell, CellsVector& cells_vector);
+
     /**
      * Insert and count recursively all lower incident cells into cells accumulator, starting from cell embedding the measure of such cell.
      * Internal use only.
@@ -0,0 +1,443 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeCalculus.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MatrixFreeCalculus.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeCalculus_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeCalculus.h
+#else // defined(MatrixFreeCalculus_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeCalculus_RECURSES
+
+#if !defined MatrixFreeCalculus_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeCalculus_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  // forward declaration
+  template <typename TCalculus, Duality duality>
+  class MatrixFreeLaplace;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeCalculus
+  /**
+   * Description of template class 'MatrixFreeCalculus' <p>
+   * \brief Aim:
+   * MatrixFreeCalculus applies the derivative, hodge, antiderivative and
+   * laplace operators of a DiscreteExteriorCalculus directly on k-forms,
+   * without assembling any sparse matrix.
+   *
+   * Cell incidences are followed in Khalimsky coordinates: a dense image
+   * over the bounding box of the calculus cells stores the k-form index of
+   * each cell, so that applying an operator only reads the incident cells of
+   * each output cell. This is well suited to calculus built on regular
+   * cubical grids (e.g. with DiscreteExteriorCalculusFactory::createFromDigitalSet),
+   * for which the index image is dense. Periodic Khalimsky spaces are not supported.
+   *
+   * Results are equal to those of the corresponding LinearOperator of the
+   * calculus. Combined with MatrixFreeLaplace, large Poisson or heat
+   * diffusion problems can be solved with Eigen iterative solvers
+   * (ConjugateGradient, BiCGSTAB) without storing the laplace operator.
+   *
+   * The calculus should not be modified while this object is used.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus.
+   */
+  template <typename TCalculus>
+  class MatrixFreeCalculus
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TCalculus Calculus;
+    typedef MatrixFreeCalculus<TCalculus> Self;
+
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::SCell SCell;
+    typedef typename KSpace::Point Point;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimensionEmbedded = Calculus::dimensionEmbedded );
+    BOOST_STATIC_CONSTANT( Dimension, dimensionAmbient = Calculus::dimensionAmbient );
+
+    /**
+     * Constructor.
+     * Builds the cell index image over the bounding box of the calculus cells.
+     * @param calculus the calculus whose operators are applied.
+     */
+    MatrixFreeCalculus(ConstAlias<Calculus> calculus);
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    MatrixFreeCalculus(const MatrixFreeCalculus& other) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    MatrixFreeCalculus& operator=(const MatrixFreeCalculus& other) = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Apply derivative operator from _order_-forms to _(order+1)_-forms.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param form input k-form.
+     * @return derivative of @a form.
+     */
+    template <Order order, Duality duality>
+    KForm<Calculus, order+1, duality>
+    derivative(const KForm<Calculus, order, duality>& form) const;
+
+    /**
+     * Apply hodge operator from duality _order_-form to opposite duality _(dimEmbedded-order)_-forms.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param form input k-form.
+     * @return hodge of @a form.
+     */
+    template <Order order, Duality duality>
+    KForm<Calculus, TCalculus::dimensionEmbedded-order, OppositeDuality<duality>::duality>
+    hodge(const KForm<Calculus, order, duality>& form) const;
+
+    /**
+     * Apply antiderivative operator from _order_-forms to _(order-1)_-forms.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param form input k-form.
+     * @return antiderivative of @a form.
+     */
+    template <Order order, Duality duality>
+    KForm<Calculus, order-1, duality>
+    antiderivative(const KForm<Calculus, order, duality>& form) const;
+
+    /**
+     * Apply laplace operator from duality 0-forms to duality 0-forms.
+     * @tparam duality duality of input 0-form.
+     * @param form input 0-form.
+     * @return laplace of @a form.
+     */
+    template <Duality duality>
+    KForm<Calculus, 0, duality>
+    laplace(const KForm<Calculus, 0, duality>& form) const;
+
+    /**
+     * Matrix free operator alpha * identity + beta * laplace on duality 0-forms,
+     * usable with Eigen iterative solvers.
+     * @tparam duality duality of 0-forms.
+     * @param alpha identity coefficient.
+     * @param beta laplace coefficient.
+     * @return matrix free operator.
+     */
+    template <Duality duality>
+    MatrixFreeLaplace<TCalculus, duality>
+    laplaceOperator(const Scalar& alpha, const Scalar& beta) const;
+
+    /**
+     * Apply derivative operator on raw k-form values.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param input input k-form values, of length kFormLength(order, duality).
+     * @param output output k-form values, resized to kFormLength(order+1, duality).
+     */
+    template <Order order, Duality duality>
+    void
+    applyDerivative(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Apply hodge operator on raw k-form values.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param input input k-form values, of length kFormLength(order, duality).
+     * @param output output k-form values, resized to kFormLength(order, duality).
+     */
+    template <Order order, Duality duality>
+    void
+    applyHodge(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Apply antiderivative operator on raw k-form values.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param input input k-form values, of length kFormLength(order, duality).
+     * @param output output k-form values, resized to kFormLength(order-1, duality).
+     */
+    template <Order order, Duality duality>
+    void
+    applyAntiderivative(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Apply laplace operator on raw 0-form values.
+     * @tparam duality duality of input 0-form.
+     * @param input input 0-form values, of length kFormLength(0, duality).
+     * @param output output 0-form values, resized to kFormLength(0, duality).
+     */
+    template <Duality duality>
+    void
+    applyLaplace(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * @return the associated calculus.
+     */
+    const Calculus& calculus() const;
+
+    /**
+     * Get k-form index of a cell from the index image.
+     * @param cell any cell.
+     * @return k-form index of @a cell, or -1 if the cell does not belong to the calculus.
+     */
+    Index
+    getCellIndex(const Cell& cell) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Associated calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Lower Khalimsky coordinates of the cells bounding box.
+     */
+    Point myLowerKCoords;
+
+    /**
+     * Upper Khalimsky coordinates of the cells bounding box.
+     */
+    Point myUpperKCoords;
+
+    /**
+     * Khalimsky coordinates strides in the index image.
+     */
+    boost::array<std::size_t, dimensionAmbient> myStrides;
+
+    /**
+     * Index image, storing the k-form index of each cell, -1 if the cell is not in the calculus.
+     */
+    std::vector<DGtal::int32_t> myIndexImage;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param kcoords Khalimsky coordinates inside the bounding box.
+     * @return offset of @a kcoords in the index image.
+     */
+    std::size_t
+    offset(const Point& kcoords) const;
+
+  }; // end of class MatrixFreeCalculus
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLaplace
+  /**
+   * Description of template class 'MatrixFreeLaplace' <p>
+   * \brief Aim:
+   * MatrixFreeLaplace represents the operator alpha * identity + beta * laplace
+   * on duality 0-forms without storing it. It models an Eigen sparse
+   * expression, hence can be given to Eigen iterative solvers, e.g.
+   * Eigen::ConjugateGradient<Operator, Eigen::Lower|Eigen::Upper, Eigen::IdentityPreconditioner>.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus.
+   * @tparam duality duality of the 0-forms.
+   */
+  template <typename TCalculus, Duality duality>
+  class MatrixFreeLaplace : public Eigen::EigenBase< MatrixFreeLaplace<TCalculus, duality> >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TCalculus Calculus;
+    typedef MatrixFreeCalculus<TCalculus> MFCalculus;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Scalar RealScalar;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef int StorageIndex;
+    typedef typename Calculus::Index Index;
+
+    enum
+    {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic,
+      IsRowMajor = false
+    };
+
+    /**
+     * Constructor.
+     * @param mf_calculus matrix free calculus.
+     * @param alpha identity coefficient.
+     * @param beta laplace coefficient.
+     */
+    MatrixFreeLaplace(ConstAlias<MFCalculus> mf_calculus, const Scalar& alpha, const Scalar& beta);
+
+    /**
+     * @return number of rows.
+     */
+    Index rows() const;
+
+    /**
+     * @return number of columns.
+     */
+    Index cols() const;
+
+    /**
+     * Lazy product with a dense vector, evaluated by Eigen.
+     * @param x dense vector.
+     */
+    template <typename Rhs>
+    Eigen::Product<MatrixFreeLaplace, Rhs, Eigen::AliasFreeProduct>
+    operator*(const Eigen::MatrixBase<Rhs>& x) const
+    {
+      return Eigen::Product<MatrixFreeLaplace, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+    }
+
+    /**
+     * Apply operator.
+     * @param input input 0-form values.
+     * @param output output 0-form values.
+     */
+    void
+    apply(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Apply operator on a 0-form.
+     * @param form input 0-form.
+     * @return output 0-form.
+     */
+    KForm<Calculus, 0, duality>
+    operator*(const KForm<Calculus, 0, duality>& form) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Associated matrix free calculus.
+     */
+    const MFCalculus* myMFCalculus;
+
+    /**
+     * Identity coefficient.
+     */
+    Scalar myAlpha;
+
+    /**
+     * Laplace coefficient.
+     */
+    Scalar myBeta;
+
+  }; // end of class MatrixFreeLaplace
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeCalculus'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeCalculus' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus>
+  std::ostream&
+  operator<<(std::ostream& out, const MatrixFreeCalculus<TCalculus>& object);
+
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /**
+     * MatrixFreeLaplace behaves as a sparse matrix for Eigen expressions.
+     */
+    template <typename TCalculus, DGtal::Duality duality>
+    struct traits< DGtal::MatrixFreeLaplace<TCalculus, duality> >
+      : public Eigen::internal::traits< Eigen::SparseMatrix<typename TCalculus::Scalar> >
+    {};
+
+    /**
+     * Product of a MatrixFreeLaplace with a dense vector.
+     */
+    template <typename TCalculus, DGtal::Duality duality, typename Rhs>
+    struct generic_product_impl<DGtal::MatrixFreeLaplace<TCalculus, duality>, Rhs, SparseShape, DenseShape, GemvProduct>
+      : generic_product_impl_base< DGtal::MatrixFreeLaplace<TCalculus, duality>, Rhs,
+                                   generic_product_impl<DGtal::MatrixFreeLaplace<TCalculus, duality>, Rhs> >
+    {
+      typedef DGtal::MatrixFreeLaplace<TCalculus, duality> Lhs;
+      typedef typename Product<Lhs, Rhs>::Scalar Scalar;
+
+      template <typename Dest>
+      static void scaleAndAddTo(Dest& dst, const Lhs& lhs, const Rhs& rhs, const Scalar& alpha)
+      {
+        typename Lhs::DenseVector output;
+        lhs.apply(rhs, output);
+        dst += alpha * output;
+      }
+    };
+  } // namespace internal
+} // namespace Eigen
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeCalculus.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeCalculus_h
+
+#undef MatrixFreeCalculus_RECURSES
+#endif // else defined(MatrixFreeCalculus_RECURSES)
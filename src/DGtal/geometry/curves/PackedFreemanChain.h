@@ -0,0 +1,332 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: A compact representation of a 4-connected Freeman
+   * chain, whose codes are stored on 2 bits (32 codes per 64-bit
+   * word), with fast decoding of its points and fast computation of
+   * its bounding box, area and number of loops.
+   *
+   * Codes have the same meaning as in FreemanChain (0: right, 1: up,
+   * 2: left, 3: down), and a PackedFreemanChain can be built from
+   * and converted to a FreemanChain. The points are decoded 4 codes
+   * (one byte) at a time, with a precomputed table of the partial
+   * displacements of each byte, so that the prefix sums of the
+   * displacements are computed without any branch. Bounding box and
+   * area are computed in the same way, and the turns between
+   * consecutive codes are counted 32 at a time with bitwise
+   * operations on whole words.
+   *
+   * The contour of a 2D shape may be extracted directly as a packed
+   * chain with readFrom2DBoundary, without building the vector of its
+   * points as Surfaces::track2DBoundaryPoints does.
+   *
+   * @code
+   * PackedFreemanChain<int> pc;
+   * pc.readFrom2DBoundary( K, SAdj, dig, bel );
+   * int min_x, min_y, max_x, max_y;
+   * pc.computeBoundingBox( min_x, min_y, max_x, max_y );
+   * std::vector< PackedFreemanChain<int>::Point > points;
+   * pc.getContourPoints( points );
+   * @endcode
+   *
+   * @tparam TInteger the type of the coordinates of the points, a
+   * model of CInteger.
+   *
+   * @see FreemanChain
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef PointVector<2,Integer> Point;
+    typedef PointVector<2,Integer> Vector;
+    typedef FreemanChain<Integer> Chain;
+    typedef DGtal::uint64_t Word;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~PackedFreemanChain();
+
+    /**
+     * Constructor.
+     * @param s a chain of codes '0', '1', '2' or '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s = "", Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const Chain & fc );
+
+    /**
+     * Removes all codes and sets the first point.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    void clear( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Appends a code at the end of the chain.
+     * @param aCode the code, 0, 1, 2 or 3.
+     */
+    void push_back( unsigned int aCode );
+
+    /**
+     * Sets the chain from a range of 4-connected points, like
+     * FreemanChain::readFromPointsRange.
+     * @tparam TConstIterator any model of forward iterator on points.
+     * @param itBegin an iterator on the first point.
+     * @param itEnd an iterator after the last point.
+     * @throw ConnectivityException if two consecutive points are not
+     * 4-adjacent.
+     */
+    template <typename TConstIterator>
+    void readFromPointsRange( TConstIterator itBegin, TConstIterator itEnd );
+
+    /**
+     * Sets the chain as the boundary of a 2D shape (specified by a
+     * predicate on points) in a 2D Khalimsky space, tracked from the
+     * given surfel. The chain is the one of the points returned by
+     * Surfaces::track2DBoundaryPoints, but the points are not stored.
+     *
+     * @tparam KSpace any model of 2D cellular grid space.
+     * @tparam PointPredicate any model of concepts::CPointPredicate.
+     * @param K any space of dimension 2.
+     * @param surfel_adj the surfel adjacency chosen for the tracking.
+     * @param pp a predicate on points characterizing the shape.
+     * @param start_surfel a signed surfel between an element of the
+     * shape and an element not in the shape.
+     * @param close when 'true', the code going from the last point to
+     * the first point is appended, so that the chain is closed.
+     */
+    template <typename KSpace, typename PointPredicate>
+    void readFrom2DBoundary( const KSpace & K,
+                             const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                             const PointPredicate & pp,
+                             const typename KSpace::SCell & start_surfel,
+                             bool close = false );
+
+    /// @return the number of codes of the chain.
+    Size size() const;
+
+    /// @return 'true' if the chain has no code.
+    bool empty() const;
+
+    /**
+     * @param pos a position in the chain.
+     * @return the code at this position (0, 1, 2 or 3).
+     */
+    unsigned int code( Index pos ) const;
+
+    /// @return the words storing the codes (code i is stored in the
+    /// bits 2(i%32) and 2(i%32)+1 of the word i/32).
+    const std::vector<Word> & words() const;
+
+    /// @return the first point of the chain.
+    Point firstPoint() const;
+
+    /// @return the last point of the chain.
+    Point lastPoint() const;
+
+    /// @return the vector from the first point to the last point.
+    Vector totalDisplacement() const;
+
+    /// @return 'true' if the last point is the first point.
+    bool isClosed() const;
+
+    /**
+     * Computes the size()+1 points of the chain (none if the chain
+     * is empty), like FreemanChain::getContourPoints.
+     * @param[out] aVContour the points of the chain.
+     */
+    void getContourPoints( std::vector<Point> & aVContour ) const;
+
+    /**
+     * Computes a bounding box of the points of the chain.
+     *
+     * @param min_x (returns) the minimal x-coordinate.
+     * @param min_y (returns) the minimal y-coordinate.
+     * @param max_x (returns) the maximal x-coordinate.
+     * @param max_y (returns) the maximal y-coordinate.
+     */
+    void computeBoundingBox( Integer & min_x, Integer & min_y,
+                             Integer & max_x, Integer & max_y ) const;
+
+    /**
+     * @return twice the signed area of the polygon of the points of
+     * the chain (positive for a counterclockwise contour), which is
+     * meaningful when the chain is closed.
+     */
+    Integer twiceSignedArea() const;
+
+    /**
+     * Same as FreemanChain::ccwLoops.
+     * @return the number of counterclockwise loops, or '0' if the
+     * contour is open or invalid (i.e. has a U-turn).
+     */
+    int ccwLoops() const;
+
+    /// @return the same chain as a FreemanChain.
+    Chain toFreemanChain() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The codes, 32 per word.
+    std::vector<Word> myWords;
+    /// The number of codes.
+    Size mySize;
+    /// The first point.
+    Point myFirst;
+    /// The last point.
+    Point myLast;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * The partial displacements of the 4 codes stored in each of the
+     * 256 possible bytes.
+     */
+    struct ByteTable
+    {
+      /// The displacements after 1, 2, 3 and 4 codes.
+      int dx[ 256 ][ 4 ];
+      int dy[ 256 ][ 4 ];
+      /// The bounds of the displacements after 1, 2, 3 and 4 codes.
+      int minX[ 256 ];
+      int maxX[ 256 ];
+      int minY[ 256 ];
+      int maxY[ 256 ];
+      /// Twice the signed area swept by the 4 codes, from the origin.
+      int area[ 256 ];
+
+      /// Constructor. Fills the tables.
+      ByteTable();
+    };
+
+    /// @return the (shared) table of the bytes.
+    static const ByteTable & byteTable();
+
+    /// @return the displacement of the given code.
+    static Vector displacement( unsigned int aCode );
+
+    /**
+     * @param j the index of a byte, i.e. of the codes [4j,4j+4).
+     * @return the byte storing these codes.
+     */
+    unsigned int byte( Index j ) const;
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
@@ -146,6 +148,18 @@ namespace DGtal
   theSegmentation.setMode("First");
    * @endcode  
    * 
+   * When the whole set of segments is needed (and not only a
+   * traversal), the computeSegments() method stores in a vector the
+   * segments visited from begin() to end(). For a range of random
+   * access iterators (not circulators), the range is split into
+   * chunks whose maximal segments are computed in parallel when
+   * OpenMP is available, and the result is exactly the one of the
+   * sequential traversal:
+   * @code
+  std::vector<SegmentComputer> segments;
+  theSegmentation.computeSegments( segments );
+   * @endcode
+   *
    * @see testSegmentation.cpp
    */
 
@@ -451,6 +465,26 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes the segments of the segmentation, i.e. the segments
+     * visited from begin() to end(), in the same order.
+     *
+     * For a range of random access iterators (not circulators), the
+     * maximal segments are computed chunk by chunk, in parallel when
+     * OpenMP is available. Since maximal segments are ordered by their
+     * (distinct) first points, each chunk of the range computes the
+     * maximal segments beginning in it, starting from the first
+     * maximal segment passing through its first point, and the
+     * segments of consecutive chunks are simply concatenated.
+     * Otherwise, the segments are computed sequentially.
+     *
+     * @param[out] segments the segments of the segmentation.
+     * @param nbChunks the number of chunks, or 0 to choose it from the
+     * size of the range.
+     */
+    void computeSegments( std::vector<SegmentComputer> & segments,
+                          std::size_t nbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -520,6 +554,28 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes the segments of the segmentation sequentially.
+     * @param[out] segments the segments of the segmentation.
+     * @param nbChunks the number of chunks (unused).
+     * @param flagChunks 'false' since the range cannot be split.
+     */
+    void computeSegments( std::vector<SegmentComputer> & segments,
+                          std::size_t nbChunks,
+                          std::false_type flagChunks ) const;
+
+    /**
+     * Computes the segments of the segmentation chunk by chunk.
+     * @param[out] segments the segments of the segmentation.
+     * @param nbChunks the number of chunks, or 0 to choose it from the
+     * size of the range.
+     * @param flagChunks 'true' since the range is a range of random
+     * access iterators.
+     */
+    void computeSegments( std::vector<SegmentComputer> & segments,
+                          std::size_t nbChunks,
+                          std::true_type flagChunks ) const;
+
   }; // end of class SaturatedSegmentation
 
 
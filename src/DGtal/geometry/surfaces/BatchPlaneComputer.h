@@ -0,0 +1,247 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchPlaneComputer.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BatchPlaneComputer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchPlaneComputer_RECURSES)
+#error Recursive header files inclusion detected in BatchPlaneComputer.h
+#else // defined(BatchPlaneComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchPlaneComputer_RECURSES
+
+#if !defined BatchPlaneComputer_h
+/** Prevents repeated inclusion of headers. */
+#define BatchPlaneComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchPlaneComputer
+  /**
+   * Description of template class 'BatchPlaneComputer' <p>
+   * \brief Aim: Recognizes digital planes on many independent
+   * patches of points (typically the neighborhoods of the surfels
+   * of a digital surface), in parallel when OpenMP is available.
+   *
+   * The points of all patches are stored one after the other in a
+   * single vector. Each patch is recognized by a plane computer which
+   * is a copy of the model given at construction (hence already
+   * initialized with the wanted axis, diameter and width). Each
+   * thread owns one such computer, which is cleared between two
+   * patches, so that no computer is copied per patch.
+   *
+   * The points of a patch are added one by one with \c extend, in the
+   * order they were given, until one of them cannot be added. The
+   * result of a patch is thus the number of points of its greatest
+   * prefix that is a piece of digital plane, and the corresponding
+   * plane parameters. Points should therefore be given by increasing
+   * distance to the center of the patch (e.g. in breadth-first
+   * order).
+   *
+   * @code
+   * typedef ChordGenericNaivePlaneComputer< Z3i::Space, Z3i::Point, int64_t > PlaneComputer;
+   * PlaneComputer model;
+   * model.init( 1, 1 );
+   * BatchPlaneComputer< PlaneComputer > batch( model );
+   * for ( ... ) // for each surfel
+   *   batch.addPatch( neighbors.begin(), neighbors.end() );
+   * std::vector< BatchPlaneComputer< PlaneComputer >::Result > results;
+   * batch.compute( results );
+   * @endcode
+   *
+   * @tparam TPlaneComputer any model of plane computer providing \c
+   * clear, \c extend and \c primitive, e.g. COBANaivePlaneComputer,
+   * COBAGenericNaivePlaneComputer, ChordNaivePlaneComputer or
+   * ChordGenericNaivePlaneComputer.
+   */
+  template <typename TPlaneComputer>
+  class BatchPlaneComputer
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TPlaneComputer PlaneComputer;
+    typedef typename PlaneComputer::value_type InputPoint;
+    typedef typename PlaneComputer::Primitive Primitive;
+    typedef std::size_t Size;
+
+    /// The result of the recognition of one patch.
+    struct Result
+    {
+      /// The number of points of the patch.
+      Size nbPoints;
+      /// The number of points of the greatest prefix of the patch
+      /// that is a piece of digital plane.
+      Size nbRecognized;
+      /// The plane recognized on this prefix.
+      Primitive primitive;
+
+      /// @return 'true' if the whole patch is a piece of digital plane.
+      bool isPlane() const
+      { return nbRecognized == nbPoints; }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~BatchPlaneComputer();
+
+    /**
+     * Constructor.
+     * @param model an initialized plane computer, which is copied
+     * (and cleared) for each thread.
+     */
+    BatchPlaneComputer( const PlaneComputer & model );
+
+    /// @return the model of plane computer.
+    const PlaneComputer & model() const;
+
+    /// Removes all patches (the memory is kept for the next patches).
+    void clear();
+
+    /**
+     * Reserves memory for the given number of patches and points.
+     * @param nbPatches the expected number of patches.
+     * @param nbPoints the expected total number of points.
+     */
+    void reserve( Size nbPatches, Size nbPoints );
+
+    /**
+     * Adds a patch, whose points are copied.
+     * @tparam TInputIterator any model of InputIterator on InputPoint.
+     * @param itB an iterator on the first point of the patch.
+     * @param itE an iterator after the last point of the patch.
+     * @return the index of the patch.
+     */
+    template <typename TInputIterator>
+    Size addPatch( TInputIterator itB, TInputIterator itE );
+
+    /// @return the number of patches.
+    Size nbPatches() const;
+
+    /// @return the total number of points of all patches.
+    Size nbPoints() const;
+
+    /**
+     * @param i the index of a patch.
+     * @return a pointer on the first point of the patch \a i.
+     */
+    const InputPoint* patchBegin( Size i ) const;
+
+    /**
+     * @param i the index of a patch.
+     * @return a pointer after the last point of the patch \a i.
+     */
+    const InputPoint* patchEnd( Size i ) const;
+
+    /**
+     * Recognizes the digital plane of each patch.
+     * @param[out] results the result of each patch, in the order of
+     * the patches.
+     */
+    void compute( std::vector<Result> & results ) const;
+
+    /**
+     * Recognizes the digital plane of the patch \a i.
+     * @param i the index of a patch.
+     * @param computer the plane computer used for the recognition,
+     * which is cleared first.
+     * @return the result of the patch.
+     */
+    Result compute( Size i, PlaneComputer & computer ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The model of plane computer.
+    PlaneComputer myModel;
+    /// The points of all patches, one patch after the other.
+    std::vector<InputPoint> myPoints;
+    /// The offset of the first point of each patch in myPoints,
+    /// followed by the total number of points.
+    std::vector<Size> myOffsets;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    BatchPlaneComputer();
+
+  }; // end of class BatchPlaneComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchPlaneComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchPlaneComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchPlaneComputer<TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/BatchPlaneComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchPlaneComputer_h
+
+#undef BatchPlaneComputer_RECURSES
+#endif // else defined(BatchPlaneComputer_RECURSES)
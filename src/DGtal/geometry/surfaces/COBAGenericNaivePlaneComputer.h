@@ -43,7 +43,6 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
@@ -129,13 +128,13 @@ namespace DGtal
   public:
     typedef TSpace Space;
     typedef typename Space::Point Point;
-    typedef std::set< Point > PointSet;
-    typedef typename PointSet::size_type Size;
-    typedef typename PointSet::const_iterator ConstIterator;
-    typedef typename PointSet::iterator Iterator;
     typedef TInternalInteger InternalInteger;
     typedef IntegerComputer< InternalInteger > MyIntegerComputer;
     typedef COBANaivePlaneComputer< Space, InternalInteger > COBAComputer;
+    typedef typename COBAComputer::PointSet PointSet;
+    typedef typename PointSet::size_type Size;
+    typedef typename PointSet::const_iterator ConstIterator;
+    typedef typename PointSet::iterator Iterator;
     typedef typename COBAComputer::Primitive Primitive;
 
     // ----------------------- std public types ------------------------------
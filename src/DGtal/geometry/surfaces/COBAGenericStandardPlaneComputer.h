@@ -41,7 +41,6 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IteratorAdapter.h"
 #include "DGtal/kernel/CInteger.h"
@@ -136,13 +135,13 @@ namespace DGtal
   public:
     typedef TSpace Space;
     typedef typename Space::Point Point;
-    typedef std::set< Point > PointSet;
-    typedef typename PointSet::size_type Size;
-    typedef typename PointSet::const_iterator PointSetConstIterator;
-    typedef typename PointSet::iterator PointSetIterator;
     typedef TInternalInteger InternalInteger;
     typedef IntegerComputer< InternalInteger > MyIntegerComputer;
     typedef COBANaivePlaneComputer< Space, InternalInteger > COBAComputer;
+    typedef typename COBAComputer::PointSet PointSet;
+    typedef typename PointSet::size_type Size;
+    typedef typename PointSet::const_iterator PointSetConstIterator;
+    typedef typename PointSet::iterator PointSetIterator;
     typedef typename COBAComputer::Primitive Primitive;
     typedef typename COBAComputer::IntegerVector3 IntegerVector3;
 
@@ -41,7 +41,6 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
@@ -135,7 +134,7 @@ namespace DGtal
     typedef ChordNaivePlaneComputer< Space, InputPoint, InternalScalar > ChordComputer;
     typedef typename ChordComputer::Primitive Primitive;
 
-    typedef std::set< InputPoint > InputPointSet;
+    typedef typename ChordComputer::InputPointSet InputPointSet;
     typedef typename InputPointSet::size_type Size;
     typedef typename InputPointSet::const_iterator ConstIterator;
     typedef typename InputPointSet::iterator Iterator;
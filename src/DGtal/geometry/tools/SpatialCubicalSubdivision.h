@@ -43,8 +43,7 @@
 #include <iostream>
 #include <vector>
 #include "DGtal/base/Common.h"
-#include "DGtal/base/Clone.h"
-#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -63,24 +62,42 @@ namespace DGtal
 
      Bins are characterized by one Point and are organized as a
      rectangular domain with lowest bin at coordinates (0,...,0).
-     
+
+     Points are stored contiguously, sorted by bin (compressed sparse
+     row layout): the points of the bin of linear index \a i are the
+     range [offsets[i], offsets[i+1]) of a single array, bins being
+     linearized with the first coordinate running fastest. Hence a
+     row of bins along the first axis is a contiguous range of points.
+     Pushed points are first stored in a pending buffer, and sorted
+     into bins by a counting sort (in parallel with OpenMP) at the
+     next call to \ref update or at the next query.
+
+     Besides box queries (\ref getPoints), the structure offers
+     Euclidean radius queries (\ref radiusSearch) and k-nearest
+     neighbors queries (\ref kNearest), for one point or a batch of
+     points (processed in parallel with OpenMP).
+
+     @note Queries are const and may be called concurrently, provided
+     that \ref update has been called after the last \ref push.
+
      @tparam TSpace the digital space, a model of CSpace.
 
      Model of CopyConstructible
-   */
+  */
   template <typename TSpace>
   class SpatialCubicalSubdivision
   {
     BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
   public:
+    typedef SpatialCubicalSubdivision<TSpace> Self;
     typedef TSpace Space;
     typedef typename Space::Point Point;
     typedef typename Space::Vector Vector;
+    typedef typename Space::Size Size;
     typedef typename Point::Coordinate Coordinate;
     typedef HyperRectDomain<Space> Domain;
     typedef std::vector<Point> Storage;
-    typedef ImageContainerBySTLVector<Domain,Storage*> StorageArray;
-    typedef typename StorageArray::ConstRange BinConstRange;
+    typedef std::vector<std::size_t> Offsets;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -111,6 +128,9 @@ namespace DGtal
     /// @return the rectangular domain of bins, which is a coarser grid than domain().
     const Domain& binDomain() const;
 
+    /// @return the number of stored points (pending ones included).
+    Size size() const;
+
     /**
        @param p any point within domain().
        @return the bin in which lies \a p.
@@ -150,6 +170,13 @@ namespace DGtal
     template <typename PointConstIterator>
     void push( PointConstIterator it, PointConstIterator itE );
 
+    /**
+       Sorts the pending points into their bins. Queries do it
+       automatically, but this method must be called before
+       concurrent queries.
+    */
+    void update();
+
     /**
        Pushes back in \a pts all the points in the bin domain [\a
        bin_lo, \a bin_up] which satisfy the predicate \a pred.
@@ -175,6 +202,51 @@ namespace DGtal
     void getPoints( std::vector<Point> & pts, 
                     Point bin_lo, Point bin_up ) const;
 
+    /**
+       Pushes back in \a pts all the points at Euclidean distance
+       less or equal to \a radius from \a p.
+
+       @param[out] pts the vector where points are pushed back for output.
+       @param p any point (not necessarily within domain()).
+       @param radius the radius of the ball centered on \a p.
+    */
+    void radiusSearch( std::vector<Point> & pts, 
+                       const Point& p, double radius ) const;
+
+    /**
+       Batch version of radiusSearch, queries being processed in parallel.
+
+       @param[out] results the i-th vector contains the points within
+       the ball of radius \a radius centered on queries[i].
+       @param queries the centers of the balls.
+       @param radius the radius of the balls.
+    */
+    void radiusSearch( std::vector<Storage> & results, 
+                       const Storage& queries, double radius ) const;
+
+    /**
+       Pushes back in \a pts the \a k stored points nearest to \a p
+       (Euclidean distance), sorted by increasing distance, or all
+       the stored points if there are less than \a k.
+
+       @param[out] pts the vector where points are pushed back for output.
+       @param p any point (not necessarily within domain()).
+       @param k the number of neighbors.
+    */
+    void kNearest( std::vector<Point> & pts, 
+                   const Point& p, Size k ) const;
+
+    /**
+       Batch version of kNearest, queries being processed in parallel.
+
+       @param[out] results the i-th vector contains the \a k nearest
+       neighbors of queries[i].
+       @param queries the points whose neighbors are searched.
+       @param k the number of neighbors.
+    */
+    void kNearest( std::vector<Storage> & results, 
+                   const Storage& queries, Size k ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -197,9 +269,15 @@ namespace DGtal
     Domain myDomain;
     /// the edge size of each bin.
     Coordinate mySize;
-    /// the image that associates to each bin its dyn. allocated
-    /// vector of points. If 0, no point is stored in this bin.
-    StorageArray myArray;
+    /// the rectangular domain of bins.
+    Domain myBinDomain;
+    /// the points, sorted by bin.
+    mutable Storage myPoints;
+    /// the offsets in myPoints of each bin, and the total number of
+    /// sorted points as last element.
+    mutable Offsets myOffsets;
+    /// the points pushed since the last update.
+    mutable Storage myPending;
     // ------------------------- Private Datas --------------------------------
   private:
     /// a precomputed point to improve performance of uppermost() method.
@@ -208,6 +286,36 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /**
+       @param b any valid bin of binDomain().
+       @return its linear index, the first coordinate running fastest.
+    */
+    std::size_t binIndex( const Point& b ) const;
+
+    /**
+       @param p any point.
+       @return the bin of the point of domain() closest to \a p.
+    */
+    Point clampedBin( const Point& p ) const;
+
+    /**
+       Sorts myPending into myPoints and myOffsets, if needed.
+    */
+    void sortPendingPoints() const;
+
+    /**
+       Calls \a f( begin, end ) for each contiguous range of points
+       lying in the bins of [\a bin_lo, \a bin_up] (clamped to
+       binDomain()), i.e. once per row of bins along the first axis.
+
+       @tparam RowFunctor the type of a functor (const Point*, const Point*) -> void.
+       @param bin_lo the lowest bin.
+       @param bin_up the uppermost bin.
+       @param f the functor.
+    */
+    template <typename RowFunctor>
+    void forEachRow( Point bin_lo, Point bin_up, RowFunctor& f ) const;
+
     // ------------------------- Internals ------------------------------------
   private:
 
@@ -47,7 +47,8 @@
 #include <iostream>
 #include <limits>
 #include <map>
-#include <set>
+#include <queue>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/images/CImage.h"
@@ -96,6 +97,33 @@ namespace DGtal
 	  return ( std::abs(a.second) < std::abs(b.second) ); 
       }
     };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueReverseCompare
+  /**
+   * Description of template class 'PointValueReverseCompare' <p>
+   * \brief Aim: Reverse order of PointValueCompare, so that a
+   * std::priority_queue using it has the candidate of smallest
+   * (absolute) distance value at its top.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueReverseCompare {
+    public: 
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if b < a but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+        return PointValueCompare<T>()(b, a); 
+      }
+    };
   }
 
   /////////////////////////////////////////////////////////////////////////////
@@ -122,8 +150,17 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a binary heap of pairs (point, 
+   * tentative value). When the tentative value of a candidate
+   * decreases, a new pair is pushed and the outdated one is
+   * discarded when it reaches the top of the heap (lazy deletion). 
+   * Accepted points are flagged in a bit array over the domain of the
+   * image, so that testing whether a point is accepted does not
+   * require a search in the set of accepted points. 
+   *
+   * The propagation stops when the area or the value threshold is
+   * reached, but the frontier is kept, so that a band can be extended
+   * later without recomputing it from scratch (see extendBand).  
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -182,8 +219,10 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     detail::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef std::priority_queue<PointValue, std::vector<PointValue>,
+		     detail::PointValueReverseCompare<PointValue> > CandidatePointSet; 
+    typedef typename Image::Domain Domain; 
+  public:
     typedef DGtal::uint64_t Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -200,10 +239,29 @@ namespace DGtal
     AcceptedPointSet& myAcceptedPoints; 
 
     /**
-     * Set of candidate points
+     * Heap of candidate points, which may contain outdated 
+     * pairs whose point has already been accepted
      */
     CandidatePointSet myCandidatePoints; 
 
+    /**
+     * Lowest point of the domain of the image, 
+     * where accepted points are flagged
+     */
+    Point myFlagLowerBound; 
+
+    /**
+     * Uppermost point of the domain of the image, 
+     * where accepted points are flagged
+     */
+    Point myFlagUpperBound; 
+
+    /**
+     * Flags of the accepted points lying within the domain of the image
+     * (points are linearized with the first coordinate running fastest)
+     */
+    std::vector<bool> myAcceptedFlags; 
+
     /**
      * Pointer on the point functor used to deduce 
      * the distance of a new point
@@ -320,6 +378,48 @@ namespace DGtal
      */
     bool computeOneStep(Point& aPoint, Value& aValue);
 
+    /** 
+     * Raises the value threshold and marches on from the current 
+     * frontier, so that the accepted points become the band of 
+     * (absolute) distance values below @a aValueThreshold, without
+     * recomputing the points already accepted. 
+     *
+     * @param aValueThreshold the new value threshold, 
+     * which should be greater than the current one. 
+     *
+     * @see compute
+     */
+    void extendBand(const Value& aValueThreshold);
+
+    /** 
+     * @return the value threshold above which the propagation stops.
+     */
+    Value valueThreshold() const;
+
+    /** 
+     * Sets the value threshold above which the propagation stops. 
+     * A further call to compute() extends the accepted points 
+     * if the threshold has been raised. 
+     *
+     * @param aValueThreshold the new value threshold
+     */
+    void setValueThreshold(const Value& aValueThreshold);
+
+    /** 
+     * @return the area threshold (in number of accepted points) 
+     * above which the propagation stops.
+     */
+    Area areaThreshold() const;
+
+    /** 
+     * Sets the area threshold above which the propagation stops. 
+     * A further call to compute() extends the accepted points 
+     * if the threshold has been raised. 
+     *
+     * @param aAreaThreshold the new area threshold
+     */
+    void setAreaThreshold(const Area& aAreaThreshold);
+
     /** 
      * Minimal distance value in the set of accepted points. 
      *
@@ -471,9 +571,33 @@ namespace DGtal
   private:
 
     /** 
-     * Initialize the set of candidate points
+     * Initialize the accepted flags and the set of candidate points
      */
     void init();
+
+    /** 
+     * @param aPoint any point
+     * @return 'true' if @a aPoint has been accepted, 
+     * 'false' otherwise.
+     */
+    bool isAccepted(const Point& aPoint) const;
+
+    /** 
+     * Flags @a aPoint as accepted, if it lies within the 
+     * domain of the image.
+     *
+     * @param aPoint any point
+     */
+    void setAcceptedFlag(const Point& aPoint);
+
+    /** 
+     * @param aPoint any point
+     * @param aIndex (returned) the index of the flag of @a aPoint, 
+     * if it lies within the domain of the image.
+     * @return 'true' if @a aPoint lies within the domain of the image, 
+     * 'false' otherwise.
+     */
+    bool getFlagIndex(const Point& aPoint, std::size_t& aIndex) const;
     
     /** 
      * Inserts the candidate of min distance into the set 
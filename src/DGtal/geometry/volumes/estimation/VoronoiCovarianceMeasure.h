@@ -40,8 +40,11 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -65,7 +68,8 @@ namespace DGtal
    * arbitrary function with given support.
    *
    * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * map \ref vcmMap, or more efficiently the two arrays \ref points
+   * and \ref vcmVector.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -121,6 +125,9 @@ namespace DGtal
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
+    typedef std::vector<MatrixNN> MatrixNNContainer;          ///< the list of matrices, indexed as points().
+    typedef DGtal::int32_t Index;                             ///< the type for indexing points of K.
+    typedef DGtal::ImageContainerBySTLVector<Domain,Index> IndexImage; ///< the type of image associating to each point of K its index (-1 elsewhere).
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -182,8 +189,28 @@ namespace DGtal
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note The map is built from \ref points and \ref vcmVector at
+    /// the first call, prefer these two methods for large sets.
+    /// @note Since the map is filled lazily, this method is not
+    /// thread-safe: call it once before sharing the object between
+    /// threads.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the points of K, without duplicates, in the order of
+    /// their first occurrence in the range given to \ref init.
+    const PointContainer& points() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell,
+    /// the i-th matrix being associated to the i-th point of \ref points.
+    const MatrixNNContainer& vcmVector() const;
+
+    /**
+       @param p any point of the domain.
+       @return the index of \a p in \ref points, or -1 if \a p is not in K.
+       @pre init must have been called before, and not \ref clean.
+    */
+    Index index( const Point& p ) const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -196,6 +223,9 @@ namespace DGtal
     VoronoiCovarianceMeasure).
     
     @param p the point where the kernel function is moved. It must lie within domain.
+
+    @note This method is thread-safe, hence several measures may be
+    computed in parallel.
     */
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
@@ -235,8 +265,14 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The points of K, without duplicates.
+    PointContainer myPoints;
+    /// The VCM of each point of K, in the same order as myPoints.
+    MatrixNNContainer myVCMs;
+    /// The image giving the index in myPoints of each point of K.
+    IndexImage* myIndexImage;
+    /// The map point -> VCM, built on demand by vcmMap().
+    mutable Point2MatrixNN myVCM;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
 
@@ -269,6 +305,16 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Accumulates the tensors \f$ (p-q)^t (p-q) \f$ of every point \a
+       p of the R-offset of K into the VCM of its closest site \a q.
+       The sites are split in slabs along the last coordinate, which
+       are processed in parallel if OpenMP is available. Each thread
+       scans the rows of its slab widened by R and sums directly into
+       the VCMs of the sites of its slab, so no extra memory is used.
+    */
+    void computeVCMs();
+
   }; // end of class VoronoiCovarianceMeasure
 
 
@@ -150,6 +150,19 @@ namespace DGtal
      */
     BreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p );
 
+    /**
+     * Constructor from a point and an initial set of marked
+     * vertices. Useful when the mark set must be initialized for the
+     * graph, e.g. a SurfelBitSet sized for the space of a digital
+     * surface.
+     *
+     * @param graph the graph in which the breadth first traversal takes place.
+     * @param p any vertex of the graph.
+     * @param marks an (empty) set of marked vertices.
+     */
+    BreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p,
+                         const MarkSet & marks );
+
     /**
        Constructor from iterators. All vertices visited between the
        iterators should be distinct two by two. The so specified set
@@ -42,6 +42,8 @@
 // Inclusions
 #include <cstdlib>
 #include <iostream>
+#include <iomanip>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <tuple>
@@ -53,11 +55,15 @@
 #include "DGtal/kernel/RegularPointEmbedder.h"
 #include "DGtal/math/MPolynomial.h"
 #include "DGtal/math/Statistic.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/PackedBinaryImage.h"
+#include "DGtal/images/Morton.h"
 #include "DGtal/images/IntervalForegroundPredicate.h"
 #include <DGtal/images/ImageLinearCellEmbedder.h>
 #include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
 #include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/OctreeImplicitDigitizer.h"
 #include "DGtal/shapes/ShapeGeometricFunctors.h"
 #include "DGtal/shapes/MeshHelpers.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
@@ -72,6 +78,7 @@
 #include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/geometry/volumes/KanungoNoise.h"
 #include "DGtal/io/Color.h"
+#include "DGtal/io/BufferedStreams.h"
 #include "DGtal/io/colormaps/GradientColorMap.h"
 #include "DGtal/io/colormaps/TickedColorMap.h"
 #include "DGtal/io/readers/MPolynomialReader.h"
@@ -81,6 +88,9 @@
 #include "DGtal/graph/DepthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 #include "DGtal/helpers/Parameters.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -135,8 +145,9 @@ namespace DGtal
       typedef ImplicitPolynomial3Shape<Space>              ImplicitShape3D;
       /// defines the digitization of an implicit shape.
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
-      /// defines a black and white image with (hyper-)rectangular domain.
-      typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      /// defines a black and white image with (hyper-)rectangular
+      /// domain, packed with one bit per point.
+      typedef PackedBinaryImage<Domain>                    BinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -206,6 +217,7 @@ namespace DGtal
           | parametersGrayScaleImage()
           | parametersDigitalSurface()
           | parametersMesh()
+          | parametersCache()
           | parametersUtilities();
       }
 
@@ -580,7 +592,8 @@ namespace DGtal
       /// Vectorizes an implicitly defined digital shape into a binary
       /// image, in the specified (hyper-)rectangular domain, and
       /// possibly add Kanungo noise to the result depending on
-      /// parameters given in \a params.
+      /// parameters given in \a params. The shape is digitized by
+      /// blocks, in parallel, with an OctreeImplicitDigitizer.
       ///
       /// @param[in] shape_digitization a smart pointer on an implicit digital shape.
       /// @param[in] shapeDomain any domain.
@@ -595,22 +608,9 @@ namespace DGtal
       {
         const Scalar noise        = params[ "noise"  ].as<Scalar>();
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
-        if ( noise <= 0.0 )
-          {
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&shape_digitization]
-                            ( const Point& p ) { return (*shape_digitization)(p); } );
-          }
-        else
-          {
-            typedef KanungoNoise< DigitizedImplicitShape3D, Domain > KanungoPredicate;
-            KanungoPredicate noisy_dshape( *shape_digitization, shapeDomain, noise );
-            std::transform( shapeDomain.begin(), shapeDomain.end(),
-                            img->begin(),
-                            [&noisy_dshape] ( const Point& p ) { return noisy_dshape(p); } );
-          }
-        return img;
+        OctreeImplicitDigitizer< Space, ImplicitShape3D > octree( *shape_digitization );
+        octree.digitize( *img );
+        return noise <= 0.0 ? img : makeBinaryImage( img, params );
       }
 
       /// Adds Kanungo noise to a binary image and returns the resulting new image. 
@@ -626,13 +626,12 @@ namespace DGtal
       {
         const Scalar noise = params[ "noise"  ].as<Scalar>();
         if ( noise <= 0.0 ) return bimage;
-        typedef KanungoNoise< BinaryImage, Domain > KanungoPredicate;
+        typedef KanungoNoise< BinaryImage, Domain,
+                              DigitalSetBySTLVector<Domain> > KanungoPredicate;
         const Domain shapeDomain    = bimage->domain();
         CountedPtr<BinaryImage> img ( new BinaryImage( shapeDomain ) );
         KanungoPredicate noisy_dshape( *bimage, shapeDomain, noise );
-        std::transform( shapeDomain.begin(), shapeDomain.end(),
-                        img->begin(),
-                        [&noisy_dshape] ( const Point& p ) { return noisy_dshape(p); } );
+        img->assign( noisy_dshape );
         return img;
       }
 
@@ -659,9 +658,7 @@ namespace DGtal
         typedef functors::IntervalForegroundPredicate<GrayScaleImage> ThresholdedImage;
         ThresholdedImage tImage( image, thresholdMin, thresholdMax );
         CountedPtr<BinaryImage> img ( new BinaryImage( domain ) );
-        std::transform( domain.begin(), domain.end(),
-                        img->begin(),
-                        [tImage] ( const Point& p ) { return tImage(p); } );
+        img->assign( tImage );
         return makeBinaryImage( img, params );
       }
 
@@ -687,9 +684,7 @@ namespace DGtal
         typedef functors::IntervalForegroundPredicate<GrayScaleImage> ThresholdedImage;
         ThresholdedImage tImage( *gray_scale_image, thresholdMin, thresholdMax );
         CountedPtr<BinaryImage> img ( new BinaryImage( domain ) );
-        std::transform( domain.begin(), domain.end(),
-                        img->begin(),
-                        [tImage] ( const Point& p ) { return tImage(p); } );
+        img->assign( tImage );
         return makeBinaryImage( img, params );
       }
 
@@ -764,7 +759,8 @@ namespace DGtal
       {
         const Domain domain = binary_image->domain(); 
         CountedPtr<GrayScaleImage> gray_scale_image( new GrayScaleImage( domain ) );
-        std::transform( binary_image->begin(), binary_image->end(),
+        const auto values = binary_image->constRange();
+        std::transform( values.begin(), values.end(),
                         gray_scale_image->begin(),
                         bool2grayscale );
         return gray_scale_image;
@@ -989,13 +985,16 @@ namespace DGtal
       ///   - nbTriesToFindABel   [   100000]: number of tries in method Surfaces::findABel
       ///   - surfaceComponents   [ "AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough componen
       ///   - surfaceTraversal    ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - chunkSize           [    65536]: the number of surfels given at once by a streamed traversal (see traverseSurfelChunks).
       static Parameters parametersDigitalSurface()
       {
         return Parameters
           ( "surfelAdjacency",   0 )
           ( "nbTriesToFindABel", 100000 )
           ( "surfaceComponents", "AnyBig" )
-          ( "surfaceTraversal",  "Default" );
+          ( "surfaceTraversal",  "Default" )
+          ( "vertexOrder",       "Default" )
+          ( "chunkSize",         65536 );
       }
 
       /// @tparam TDigitalSurfaceContainer either kind of DigitalSurfaceContainer
@@ -1296,6 +1295,7 @@ namespace DGtal
       ///
       /// @param[in] params the parameters:
       ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///   - vertexOrder       ["Default"]: "Default"|"Morton"|"Hilbert": "Default" vertices are numbered in the order of the surfel set, "Morton"/"Hilbert": vertices are numbered along a Morton/Hilbert curve, see getSurfelPermutation.
       ///
       /// @return a smart pointer on the indexed digital surface built over the surfels.
       template <typename TSurfelRange>
@@ -1306,13 +1306,23 @@ namespace DGtal
           const Parameters&    params = parametersDigitalSurface() )
         {
           bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
+          std::string vertex_order   = params[ "vertexOrder" ].as<std::string>();
           SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
           // Build indexed digital surface.
           CountedPtr<ExplicitSurfaceContainer> ptrSurfContainer
             ( new ExplicitSurfaceContainer( K, surfAdj, surfels ) );
           CountedPtr<IdxDigitalSurface> ptrSurface
             ( new IdxDigitalSurface() );
-          bool ok = ptrSurface->build( ptrSurfContainer );
+          SurfelRange vertex_surfels;
+          if ( vertex_order == "Morton" || vertex_order == "Hilbert" )
+            {
+              const SurfelSet& surfel_set = ptrSurfContainer->surfelSet();
+              const SurfelRange set_surfels( surfel_set.begin(), surfel_set.end() );
+              vertex_surfels = getPermutedRange
+                ( set_surfels,
+                  getSurfelPermutation( ptrSurfContainer->space(), set_surfels, vertex_order ) );
+            }
+          bool ok = ptrSurface->build( ptrSurfContainer, vertex_surfels );
           if ( !ok )
             trace.warning() << "[Shortcuts::makeIdxDigitalSurface]"
                             << " Error building indexed digital surface." << std::endl;
@@ -1534,7 +1544,7 @@ namespace DGtal
       /// @param[in] surface a smart pointer on a (light or not) digital surface (e.g. DigitalSurface or LightDigitalSurface).
       ///
       /// @param[in] params the parameters:
-      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst"|"Morton"|"Hilbert": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal, "Morton"/"Hilbert": default traversal sorted along a Morton/Hilbert curve (see getSurfelPermutation).
       ///
       /// @return a range of surfels as a vector.
       template <typename TDigitalSurfaceContainer>
@@ -1557,7 +1567,7 @@ namespace DGtal
       /// in case of depth-first/breadth-first traversal.
       ///
       /// @param[in] params the parameters:
-      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst"|"Morton"|"Hilbert": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal, "Morton"/"Hilbert": default traversal sorted along a Morton/Hilbert curve (see getSurfelPermutation).
       ///
       /// @return a range of surfels as a vector.
       template <typename TDigitalSurfaceContainer>
@@ -1590,17 +1600,80 @@ namespace DGtal
           {
             std::for_each( surface->begin(), surface->end(),
                            [&result] ( Surfel s ) { result.push_back( s ); } );
+            if ( traversal == "Morton" || traversal == "Hilbert" )
+              result = getPermutedRange
+                ( result, getSurfelPermutation( refKSpace( surface ), result, traversal ) );
           }
         return result;
       }
 
+      /// Traverses a light digital surface in some specified order,
+      /// like getSurfelRange, but gives its surfels by chunks to the
+      /// function \a f instead of storing them all. Only two chunks are
+      /// stored at once, so that the surfels of a big surface are
+      /// processed within a bounded memory (apart from the marks of the
+      /// depth-first/breadth-first traversals).
+      ///
+      /// When several threads are available (OpenMP), the next chunk
+      /// is extracted while \a f processes the current one, so that \a
+      /// f must not use the traversal of \a surface (it may use the
+      /// surface otherwise). The calls to \a f are done in the order of
+      /// the traversal, one at a time.
+      ///
+      /// @code
+      /// SH3::traverseSurfelChunks( surface, [&] ( const SH3::SurfelRange& chunk )
+      ///   { auto normals = SHG3::getTrivialNormalVectors( K, chunk ); ... }, params );
+      /// @endcode
+      ///
+      /// @tparam TDigitalSurfaceContainer either kind of DigitalSurfaceContainer
+      ///
+      /// @tparam TChunkFunction the type of a function `void( const SurfelRange& )`.
+      ///
+      /// @param[in] surface a smart pointer on a (light or not) digital surface (e.g. DigitalSurface or LightDigitalSurface).
+      ///
+      /// @param[in] f the function called on each chunk of surfels.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - chunkSize         [    65536]: the (maximal) number of surfels of each chunk.
+      ///
+      /// @return the number of traversed surfels.
+      template <typename TDigitalSurfaceContainer, typename TChunkFunction>
+      static std::size_t
+      traverseSurfelChunks
+      ( CountedPtr< ::DGtal::DigitalSurface<TDigitalSurfaceContainer> > surface,
+        TChunkFunction      f,
+        const Parameters&   params = parametersDigitalSurface() )
+      {
+        typedef ::DGtal::DigitalSurface<TDigitalSurfaceContainer> AnyDigitalSurface;
+        const Surfel      start_surfel = *( surface->begin() );
+        std::string       traversal    = params[ "surfaceTraversal" ].as<std::string>();
+        const std::size_t chunk_size = std::max( 1, params[ "chunkSize" ].as<int>() );
+        if ( traversal == "DepthFirst" )
+          {
+            typedef DepthFirstVisitor< AnyDigitalSurface > Visitor;
+            typedef GraphVisitorRange< Visitor > VisitorRange;
+            VisitorRange range( new Visitor( *surface, start_surfel ) );
+            return pipeSurfelChunks( range.begin(), range.end(), chunk_size, f );
+          }
+        else if ( traversal == "BreadthFirst" )
+          {
+            typedef BreadthFirstVisitor< AnyDigitalSurface > Visitor;
+            typedef GraphVisitorRange< Visitor > VisitorRange;
+            VisitorRange range( new Visitor( *surface, start_surfel ) );
+            return pipeSurfelChunks( range.begin(), range.end(), chunk_size, f );
+          }
+        else
+          return pipeSurfelChunks( surface->begin(), surface->end(), chunk_size, f );
+      }
+
       /// Given an indexed digital surface, returns a vector of surfels in
       /// some specified order.
       ///
       /// @param[in] surface a smart pointer on a digital surface.
       ///
       /// @param[in] params the parameters:
-      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst"|"Morton"|"Hilbert": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal, "Morton"/"Hilbert": vertices sorted along a Morton/Hilbert curve (see getSurfelPermutation).
       ///
       /// @return a range of indexed surfels as a vector.
       static IdxSurfelRange
@@ -1620,7 +1693,7 @@ namespace DGtal
       /// in case of depth-first/breadth-first traversal.
       ///
       /// @param[in] params the parameters:
-      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst"|"Morton"|"Hilbert": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal, "Morton"/"Hilbert": vertices sorted along a Morton/Hilbert curve (see getSurfelPermutation).
       ///
       /// @return a range of indexed surfels as a vector.
       static IdxSurfelRange
@@ -1647,10 +1720,134 @@ namespace DGtal
             std::for_each( range.begin(), range.end(),
                            [&result] ( IdxSurfel s ) { result.push_back( s ); } );
           }
+        else if ( traversal == "Morton" || traversal == "Hilbert" )
+          {
+            const IdxSurfelRange vertices = surface->allVertices();
+            SurfelRange surfels( vertices.size() );
+            for ( std::size_t i = 0; i < vertices.size(); ++i )
+              surfels[ i ] = surface->surfel( vertices[ i ] );
+            return getPermutedRange
+              ( vertices, getSurfelPermutation( surface->space(), surfels, traversal ) );
+          }
         else return surface->allVertices();
         return result;
       }
 
+      /// Given a range of surfels of the space \a K, returns the
+      /// permutation that sorts them along a space-filling curve, so
+      /// that surfels that are close in the sequence are also close in
+      /// space. Estimators that look at the neighborhood of each
+      /// surfel (e.g. integral invariants) access the memory in a more
+      /// coherent way when processing the surfels in this order.
+      ///
+      /// Surfels are sorted according to their Khalimsky coordinates
+      /// (relative to the lower bound of \a K), hence they are all
+      /// distinct along the curve. Keys are computed with the Morton
+      /// class and have 64 bits, so the curves are exact for spaces of
+      /// less than 2^(64/dim-1) spels along each axis (i.e. one million
+      /// in 3D). Results may be reported in the original order with
+      /// getUnpermutedRange.
+      ///
+      /// @code
+      /// auto surfels  = SH3::getSurfelRange( surface );
+      /// auto perm     = SH3::getSurfelPermutation( K, surfels, "Hilbert" );
+      /// auto normals  = SHG3::getIINormalVectors( bimage, SH3::getPermutedRange( surfels, perm ), params );
+      /// normals       = SH3::getUnpermutedRange( normals, perm ); // same order as surfels
+      /// @endcode
+      ///
+      /// @param[in] K any Khalimsky space containing the surfels.
+      ///
+      /// @param[in] surfels any range of (signed) cells of \a K.
+      ///
+      /// @param[in] curve "Morton"|"Hilbert": the space-filling curve
+      /// (Z-order or Hilbert curve), any other value gives the identity.
+      ///
+      /// @return the permutation \a perm such that `perm[ i ]` is the
+      /// index in \a surfels of the i-th surfel along the curve.
+      static IdxRange
+      getSurfelPermutation
+      ( const KSpace&       K,
+        const SurfelRange&  surfels,
+        const std::string&  curve )
+      {
+        typedef DGtal::uint64_t Key;
+        const std::ptrdiff_t nb = surfels.size();
+        IdxRange perm( nb );
+        for ( std::ptrdiff_t i = 0; i < nb; ++i ) perm[ i ] = (Idx) i;
+        const bool hilbert = ( curve == "Hilbert" );
+        if ( ! hilbert && curve != "Morton" ) return perm;
+        // Number of bits of the relative Khalimsky coordinates.
+        const Point lo = K.lowerBound();
+        const unsigned int max_bits = 64 / KSpace::dimension;
+        unsigned int bits = 1;
+        for ( Dimension k = 0; k < KSpace::dimension; ++k )
+          while ( bits < max_bits
+                  && ( DGtal::uint64_t( 1 ) << bits )
+                  <= DGtal::uint64_t( 2 * ( K.upperBound()[ k ] - lo[ k ] ) + 2 ) )
+            ++bits;
+        Morton< Key, Point > morton;
+        std::vector< std::pair< Key, Idx > > keys( nb );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for ( std::ptrdiff_t i = 0; i < nb; ++i )
+          {
+            Point p = K.sKCoords( surfels[ i ] ) - lo - lo;
+            if ( hilbert ) p = getHilbertTransposedCoordinates( p, bits );
+            morton.interleaveBits( p, keys[ i ].first );
+            keys[ i ].second = (Idx) i;
+          }
+        std::sort( keys.begin(), keys.end() );
+        for ( std::ptrdiff_t i = 0; i < nb; ++i ) perm[ i ] = keys[ i ].second;
+        return perm;
+      }
+
+      /// Reorders a range of values according to a permutation.
+      ///
+      /// @tparam TValue the type of the values.
+      ///
+      /// @param[in] values any range of values (e.g. surfels, scalars, vectors).
+      ///
+      /// @param[in] perm a permutation of the indices of \a values (e.g.
+      /// given by getSurfelPermutation).
+      ///
+      /// @return the range whose i-th value is `values[ perm[ i ] ]`.
+      template <typename TValue>
+      static std::vector<TValue>
+      getPermutedRange
+      ( const std::vector<TValue>& values,
+        const IdxRange&            perm )
+      {
+        ASSERT( values.size() == perm.size() );
+        std::vector<TValue> result;
+        result.reserve( perm.size() );
+        for ( auto i : perm ) result.push_back( values[ i ] );
+        return result;
+      }
+
+      /// Restores the original order of a range of values that was
+      /// reordered (or computed from a range reordered) with
+      /// getPermutedRange.
+      ///
+      /// @tparam TValue the type of the values.
+      ///
+      /// @param[in] values any range of values in the permuted order.
+      ///
+      /// @param[in] perm the permutation used to reorder the values.
+      ///
+      /// @return the range whose `perm[ i ]`-th value is `values[ i ]`.
+      template <typename TValue>
+      static std::vector<TValue>
+      getUnpermutedRange
+      ( const std::vector<TValue>& values,
+        const IdxRange&            perm )
+      {
+        ASSERT( values.size() == perm.size() );
+        std::vector<TValue> result( values.size() );
+        for ( std::size_t i = 0; i < perm.size(); ++i ) result[ perm[ i ] ] = values[ i ];
+        return result;
+      }
+
       /// Outputs a digital surface as an OBJ file (with its topology)
       /// and a material MTL file. Optionnaly you can specify the
       /// surfels normals and diffuse colors, and even specify how
@@ -1695,12 +1892,13 @@ namespace DGtal
             }
 
           std::ofstream output_obj( objfile.c_str() );
-          output_obj << "#  OBJ format" << std::endl;
-          output_obj << "# DGtal::MeshHelpers::exportOBJwithFaceNormalAndColor" << std::endl;
-          output_obj << "o anObject" << std::endl;
+          BufferedStreamWriter writer( output_obj );
+          writer << "#  OBJ format\n";
+          writer << "# DGtal::MeshHelpers::exportOBJwithFaceNormalAndColor\n";
+          writer << "o anObject\n";
 		  //remove directory to write material
           auto indexpath = objfile.find_last_of("/");
-          output_obj << "mtllib " << mtlfile.substr(indexpath+1) << std::endl;
+          writer << "mtllib " << mtlfile.substr(indexpath+1) << '\n';
           std::ofstream output_mtl( mtlfile.c_str() );
           output_mtl << "#  MTL format"<< std::endl;
           output_mtl << "# generated from MeshWriter from the DGTal library"<< std::endl;
@@ -1711,7 +1909,7 @@ namespace DGtal
           for ( auto&& pointel : pointels )
             {
               RealPoint p = embedder( pointel );
-              output_obj << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << std::endl;
+              writer << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << '\n';
             }	
           // Taking care of normals
           Idx nbfaces = digsurf->size();
@@ -1721,7 +1919,7 @@ namespace DGtal
               for ( Idx f = 0; f < nbfaces; ++f )
                 {
                   const auto& p = normals[ f ];
-                  output_obj << "vn " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << std::endl;
+                  writer << "vn " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << '\n';
                 }
             }
           // Taking care of materials
@@ -1751,26 +1949,27 @@ namespace DGtal
           Idx f = 0;
           for ( auto&& surfel : *digsurf )
             {
-              output_obj << "usemtl material_"
-                         << ( has_material ? mapMaterial[ diffuse_colors[ f ] ] : idxMaterial )
-                         << std::endl; 
-              output_obj << "f";
+              writer << "usemtl material_"
+                     << ( has_material ? mapMaterial[ diffuse_colors[ f ] ] : idxMaterial )
+                     << '\n'; 
+              writer << "f";
               auto primal_vtcs = getPointelRange( K, surfel );
               // The +1 in lines below is because indexing starts at 1 in OBJ file format.
               if ( has_normals )
                 {
                   for ( auto&& primal_vtx : primal_vtcs )
-                    output_obj << " " << (c2i[ primal_vtx ]+1) << "//" << (f+1);
+                    writer << " " << (c2i[ primal_vtx ]+1) << "//" << (f+1);
                 }
               else
                 {
                   for ( auto&& primal_vtx : primal_vtcs )
-                    output_obj << " " << (c2i[ primal_vtx ]+1);
+                    writer << " " << (c2i[ primal_vtx ]+1);
                 }
-              output_obj << std::endl;
+              writer << '\n';
               f += 1;
             }
           output_mtl.close();
+          writer.flush();
           return output_obj.good();
         }
     
@@ -1871,16 +2070,17 @@ namespace DGtal
               mtlfile  = objfile.substr(0, lastindex) + ".mtl"; 
             }
           std::ofstream output_obj( objfile.c_str() );
-          output_obj << "#  OBJ format" << std::endl;
-          output_obj << "# DGtal::saveOBJ" << std::endl;
-          output_obj << "o vectors" << std::endl;
-          output_obj << "mtllib " << mtlfile << std::endl;
+          BufferedStreamWriter writer( output_obj );
+          writer << "#  OBJ format\n";
+          writer << "# DGtal::saveOBJ\n";
+          writer << "o vectors\n";
+          writer << "mtllib " << mtlfile << '\n';
           std::ofstream output_mtl( mtlfile.c_str() );
           output_mtl << "#  MTL format"<< std::endl;
           output_mtl << "# generated from MeshWriter from the DGTal library"<< std::endl;
 	  // Output vertices
 	  unsigned int n = std::min( positions.size(), vf.size() );
-	  for ( unsigned int i = 0; i < n; ++i )
+          formatRecords( writer, n, [&] ( BufferedStreamWriter& writer, std::size_t i )
 	    {
 	      RealPoint    p0 = positions[ i ];
 	      RealPoint    p1 = p0 + vf[ i ];
@@ -1897,12 +2097,12 @@ namespace DGtal
 	      for ( unsigned int j = 0; j < 4; ++j ) {
 		RealPoint pt0 = p0 + t[ j ];
 		RealPoint pt1 = p1 + t[ j ];
-		output_obj << "v " << pt0[ 0 ] << " " << pt0[ 1 ] << " " << pt0[ 2 ]
-			   << std::endl;
-		output_obj << "v " << pt1[ 0 ] << " " << pt1[ 1 ] << " " << pt1[ 2 ]
-			   << std::endl;
+		writer << "v " << pt0[ 0 ] << " " << pt0[ 1 ] << " " << pt0[ 2 ]
+		       << '\n';
+		writer << "v " << pt1[ 0 ] << " " << pt1[ 1 ] << " " << pt1[ 2 ]
+		       << '\n';
 	      }
-	    }
+	    } );
 	  // Simplify materials (very useful for blender).
           std::map<Color,Idx> map_colors;
 	  {
@@ -1922,21 +2122,22 @@ namespace DGtal
 	    MeshHelpers::exportMTLNewMaterial
 	      ( output_mtl, 0, ambient_color, diffuse_color, specular_color );
 	  // Output faces
-	  for ( Idx i = 0; i < n; ++i )
+          formatRecords( writer, n, [&] ( BufferedStreamWriter& writer, std::size_t i )
             {
-              output_obj << "usemtl material_" // << ( has_material ? i : 0 )
-                         << ( has_material ? map_colors[ diffuse_colors[ i ] ] : 0 )
-                         << std::endl;
+              writer << "usemtl material_" // << ( has_material ? i : 0 )
+                     << ( has_material ? map_colors.find( diffuse_colors[ i ] )->second : 0 )
+                     << '\n';
 	      Idx b = 8*i+1;
 	      for ( Idx j = 0; j < 8; j += 2 )
-		output_obj << "f " << (b+j) << " " << (b+j+1)
-			   << " " << (b+(j+3)%8) << " " << (b+(j+2)%8) << std::endl;
-	      output_obj << "f " << b << " " << (b+2)
-			 << " " << (b+4) << " " << (b+6) << std::endl;
-	      output_obj << "f " << (b+1) << " " << (b+7)
-			 << " " << (b+5) << " " << (b+3) << std::endl;
-	    }
+		writer << "f " << (b+j) << " " << (b+j+1)
+		       << " " << (b+(j+3)%8) << " " << (b+(j+2)%8) << '\n';
+	      writer << "f " << b << " " << (b+2)
+		     << " " << (b+4) << " " << (b+6) << '\n';
+	      writer << "f " << (b+1) << " " << (b+7)
+		     << " " << (b+5) << " " << (b+3) << '\n';
+	    } );
           output_mtl.close();
+          writer.flush();
           return output_obj.good();
 	}
       
@@ -2395,6 +2596,307 @@ namespace DGtal
 
 
     
+      // ------------------------------ cache services ------------------------------
+    public:
+
+      /// @return the parameters and their default values which are
+      /// related to the on-disk cache of surfaces and estimations.
+      ///   - cacheDirectory [ "." ]: the directory where cached data are written and read.
+      static Parameters parametersCache()
+      {
+        return Parameters
+          ( "cacheDirectory", "." );
+      }
+
+      /// Computes a key identifying the data from which something is
+      /// computed: the domain and the values of a binary image, all the
+      /// parameters, the kind of the computed data, and possibly a
+      /// range of surfels. Hence cached data are found again only when
+      /// all of these are the same.
+      ///
+      /// @param[in] bimage a binary image.
+      /// @param[in] params the parameters of the computation.
+      /// @param[in] kind the kind of the computed data (e.g. "IdxDigitalSurface").
+      /// @param[in] surfels a range of surfels (empty by default).
+      ///
+      /// @return the 64-bit FNV-1a hash of these data, as 16 hexadecimal digits.
+      static std::string
+        getCacheKey( CountedPtr<BinaryImage> bimage,
+                     const Parameters&       params,
+                     const std::string&      kind,
+                     const SurfelRange&      surfels = SurfelRange() )
+      {
+        DGtal::uint64_t h = 14695981039346656037ULL;
+        auto hash = [&h] ( const void* data, std::size_t n )
+          {
+            const unsigned char* c = static_cast<const unsigned char*>( data );
+            for ( std::size_t i = 0; i < n; ++i )
+              {
+                h ^= c[ i ];
+                h *= 1099511628211ULL;
+              }
+          };
+        std::ostringstream sparams;
+        sparams << kind << params;
+        hash( sparams.str().data(), sparams.str().size() );
+        const Point lo = bimage->domain().lowerBound();
+        const Point up = bimage->domain().upperBound();
+        hash( lo.data(), Space::dimension * sizeof( Integer ) );
+        hash( up.data(), Space::dimension * sizeof( Integer ) );
+        const auto& words = bimage->words();
+        hash( words.data(), words.size() * sizeof( words[ 0 ] ) );
+        for ( auto&& s : surfels )
+          {
+            hash( s.preCell().coordinates.data(), Space::dimension * sizeof( Integer ) );
+            const char sign = s.preCell().positive ? 1 : 0;
+            hash( &sign, 1 );
+          }
+        std::ostringstream skey;
+        skey << std::hex << std::setw( 16 ) << std::setfill( '0' ) << h;
+        return skey.str();
+      }
+
+      /// Same as getCacheKey( bimage, params, kind, surfels ), but
+      /// also keys the bounds of the Khalimsky space \a K and whether
+      /// it is closed, open or periodic along each dimension, since the
+      /// same image gives other surfels in another space.
+      ///
+      /// @param[in] bimage a binary image.
+      /// @param[in] K the Khalimsky space of the computed data.
+      /// @param[in] params the parameters of the computation.
+      /// @param[in] kind the kind of the computed data (e.g. "IdxDigitalSurface").
+      /// @param[in] surfels a range of surfels (empty by default).
+      ///
+      /// @return the 64-bit FNV-1a hash of these data, as 16 hexadecimal digits.
+      static std::string
+        getCacheKey( CountedPtr<BinaryImage> bimage,
+                     const KSpace&           K,
+                     const Parameters&       params,
+                     const std::string&      kind,
+                     const SurfelRange&      surfels = SurfelRange() )
+      {
+        std::ostringstream skind;
+        skind << kind << " K=" << K.lowerBound() << K.upperBound();
+        for ( Dimension k = 0; k < KSpace::dimension; ++k )
+          skind << ( K.isSpacePeriodic( k ) ? " periodic"
+                     : K.isSpaceClosed( k ) ? " closed" : " open" );
+        return getCacheKey( bimage, params, skind.str(), surfels );
+      }
+
+      /// Builds an indexed digital surface from a space \a K and a
+      /// binary image \a bimage, like makeIdxDigitalSurface, but reads
+      /// its surfels from the cache when they have already been
+      /// computed with the same image and parameters. Otherwise, the
+      /// surfels of the built surface are written into the cache.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      ///
+      /// @param[in] params the parameters of makeIdxDigitalSurface, and:
+      ///   - cacheDirectory [ "." ]: the directory where cached data are written and read.
+      ///
+      /// @return a smart pointer on the required indexed digital surface.
+      static CountedPtr<IdxDigitalSurface>
+        makeCachedIdxDigitalSurface
+        ( CountedPtr<BinaryImage> bimage,
+          const KSpace&           K,
+          const Parameters&       params = parametersDigitalSurface()
+                                           | parametersCache() )
+      {
+        const std::string filename = params[ "cacheDirectory" ].as<std::string>()
+          + "/" + getCacheKey( bimage, K, params, "IdxDigitalSurface" ) + ".surfels";
+        SurfelRange surfels;
+        if ( loadCachedSurfels( surfels, K, filename ) )
+          {
+            const SurfelSet surfel_set( surfels.begin(), surfels.end() );
+            return makeIdxDigitalSurface( surfel_set, K, params );
+          }
+        auto surface    = makeIdxDigitalSurface( bimage, K, params );
+        auto idx2surfel = surface->surfels();
+        surfels.resize( surface->nbVertices() );
+        for ( Idx i = 0; i < surfels.size(); ++i ) surfels[ i ] = idx2surfel[ i ];
+        if ( ! saveCachedSurfels( surfels, filename ) )
+          trace.warning() << "[Shortcuts::makeCachedIdxDigitalSurface]"
+                          << " Unable to write cache file " << filename << std::endl;
+        return surface;
+      }
+
+      /// Writes a range of surfels into a binary cache file.
+      ///
+      /// @param[in] surfels any range of surfels.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file was written.
+      static bool
+        saveCachedSurfels( const SurfelRange& surfels, const std::string& filename )
+      {
+        std::vector< Integer > data;
+        data.reserve( surfels.size() * ( Space::dimension + 1 ) );
+        for ( auto&& s : surfels )
+          {
+            for ( Dimension k = 0; k < Space::dimension; ++k )
+              data.push_back( s.preCell().coordinates[ k ] );
+            data.push_back( s.preCell().positive ? 1 : 0 );
+          }
+        return saveCacheFile( data, Space::dimension + 1, filename );
+      }
+
+      /// Reads a range of surfels from a binary cache file.
+      ///
+      /// @param[out] surfels the range of surfels.
+      /// @param[in] K the Khalimsky space of the surfels.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file exists and is a valid cache file of
+      /// surfels, all of them lying in \a K.
+      static bool
+        loadCachedSurfels( SurfelRange& surfels, const KSpace& K,
+                           const std::string& filename )
+      {
+        std::vector< Integer > data;
+        if ( ! loadCacheFile( data, Space::dimension + 1, filename ) ) return false;
+        surfels.resize( data.size() / ( Space::dimension + 1 ) );
+        auto it = data.cbegin();
+        for ( auto&& s : surfels )
+          {
+            Point p;
+            for ( Dimension k = 0; k < Space::dimension; ++k ) p[ k ] = *it++;
+            const typename KSpace::SPreCell c( p, *it++ != 0 );
+            if ( ! K.sIsValid( c ) ) return false;
+            s = K.sCell( c );
+            if ( ! K.sIsSurfel( s ) ) return false;
+          }
+        return true;
+      }
+
+      /// Writes a range of scalars into a binary cache file.
+      ///
+      /// @param[in] values any range of scalars.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file was written.
+      static bool
+        saveCachedScalars( const Scalars& values, const std::string& filename )
+      {
+        return saveCacheFile( values, 1, filename );
+      }
+
+      /// Reads a range of scalars from a binary cache file.
+      ///
+      /// @param[out] values the range of scalars.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file exists and is a valid cache file of scalars.
+      static bool
+        loadCachedScalars( Scalars& values, const std::string& filename )
+      {
+        return loadCacheFile( values, 1, filename );
+      }
+
+      /// Writes a range of vectors into a binary cache file.
+      ///
+      /// @param[in] vectors any range of vectors.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file was written.
+      static bool
+        saveCachedRealVectors( const RealVectors& vectors, const std::string& filename )
+      {
+        Scalars data;
+        data.reserve( vectors.size() * Space::dimension );
+        for ( auto&& v : vectors )
+          data.insert( data.end(), v.begin(), v.end() );
+        return saveCacheFile( data, Space::dimension, filename );
+      }
+
+      /// Reads a range of vectors from a binary cache file.
+      ///
+      /// @param[out] vectors the range of vectors.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file exists and is a valid cache file of vectors.
+      static bool
+        loadCachedRealVectors( RealVectors& vectors, const std::string& filename )
+      {
+        Scalars data;
+        if ( ! loadCacheFile( data, Space::dimension, filename ) ) return false;
+        vectors.resize( data.size() / Space::dimension );
+        auto it = data.cbegin();
+        for ( auto&& v : vectors )
+          for ( Dimension k = 0; k < Space::dimension; ++k ) v[ k ] = *it++;
+        return true;
+      }
+
+      /// Writes numbers into a binary cache file. The file starts with
+      /// the string "DGtalCache", the endianness of the host (1 if
+      /// little endian, 0 otherwise), the size of a number (1 byte
+      /// each), the number of numbers per element (4 bytes) and the
+      /// number of numbers (8 bytes). Then follow the raw numbers.
+      ///
+      /// @tparam TNumber any arithmetic type.
+      /// @param[in] data the numbers.
+      /// @param[in] width the number of numbers per element.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file was written.
+      template <typename TNumber>
+        static bool
+        saveCacheFile( const std::vector< TNumber >& data, unsigned int width,
+                       const std::string& filename )
+      {
+        std::ofstream output( filename.c_str(), std::ios::binary );
+        if ( ! output.good() ) return false;
+        BufferedStreamWriter writer( output );
+        writer.write( "DGtalCache", 10 );
+        writer.writeBinary( (DGtal::uint8_t) ( BufferedStreamWriter::isLittleEndian() ? 1 : 0 ) );
+        writer.writeBinary( (DGtal::uint8_t) sizeof( TNumber ) );
+        writer.writeBinary( (DGtal::uint32_t) width );
+        writer.writeBinary( (DGtal::uint64_t) data.size() );
+        for ( auto x : data ) writer.writeBinary( x );
+        writer.flush();
+        return writer.good();
+      }
+
+      /// Reads numbers from a binary cache file (see saveCacheFile). The
+      /// file is read at once in memory, and its numbers are converted
+      /// if it was written on a host with another endianness.
+      ///
+      /// @tparam TNumber any arithmetic type.
+      /// @param[out] data the numbers.
+      /// @param[in] width the expected number of numbers per element.
+      /// @param[in] filename the name of the file.
+      /// @return 'true' if the file exists and contains numbers of
+      /// type TNumber, by elements of \a width numbers.
+      template <typename TNumber>
+        static bool
+        loadCacheFile( std::vector< TNumber >& data, unsigned int width,
+                       const std::string& filename )
+      {
+        std::ifstream input( filename.c_str(), std::ios::binary );
+        if ( ! input.good() ) return false;
+        // The count of the header is checked against the file length,
+        // so that a truncated or corrupted file is a mere cache miss.
+        input.seekg( 0, std::ios::end );
+        const std::streamoff length = input.tellg();
+        input.seekg( 0, std::ios::beg );
+        const std::streamoff header = 10 + 1 + 1 + 4 + 8;
+        if ( ! input.good() || length < header ) return false;
+        BufferedStreamReader reader( input );
+        char magic[ 10 ];
+        for ( auto& c : magic ) reader.readBinary( c );
+        DGtal::uint8_t  little = 0, size = 0;
+        DGtal::uint32_t w = 0;
+        DGtal::uint64_t n = 0;
+        reader.readBinary( little );
+        reader.readBinary( size );
+        const bool swap = ( little == 1 ) != BufferedStreamWriter::isLittleEndian();
+        reader.readBinary( w, swap );
+        reader.readBinary( n, swap );
+        if ( ! reader.good() || std::string( magic, 10 ) != "DGtalCache"
+             || size != sizeof( TNumber ) || w != width || n % width != 0
+             || n > DGtal::uint64_t( length - header ) / sizeof( TNumber ) )
+          return false;
+        data.resize( n );
+        for ( auto& x : data ) reader.readBinary( x, swap );
+        return reader.good();
+      }
+
       // ------------------------------ utilities ------------------------------
     public:
 
@@ -2548,33 +3050,42 @@ namespace DGtal
           typedef unsigned long Size;
           BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
           BOOST_CONCEPT_ASSERT(( concepts::CCellEmbedder< TCellEmbedder > ));
+          BufferedStreamWriter writer( output );
           const KSpace& K = embedder.space();
-          // Number and output vertices.
+          // Number vertices.
           std::map< Cell, Size > vtx_numbering;
+          CellRange vertices;
           Size n = 1;  // OBJ vertex numbering start at 1 
           for ( auto&& s : surfels )
             {
-              auto primal_vtcs = getPointelRange( K, s, true );
+              auto primal_vtcs = getPointelRange( K, s );
               for ( auto&& primal_vtx : primal_vtcs )
                 {
                   if ( ! vtx_numbering.count( primal_vtx ) )
                     {
                       vtx_numbering[ primal_vtx ] = n++;
-                      // Output vertex positions
-                      RealPoint p = embedder( primal_vtx );
-                      output << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << std::endl;
+                      vertices.push_back( primal_vtx );
                     }
                 }
             }
+          // Output vertex positions
+          formatRecords( writer, vertices.size(),
+                         [&] ( BufferedStreamWriter& writer, std::size_t i )
+            {
+              RealPoint p = embedder( vertices[ i ] );
+              writer << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << '\n';
+            } );
           // Outputs all faces
-          for ( auto&& s : surfels )
+          formatRecords( writer, surfels.size(),
+                         [&] ( BufferedStreamWriter& writer, std::size_t i )
             {
-              output << "f";
-              auto primal_vtcs = getPointelRange( K, s, true );
+              writer << "f";
+              auto primal_vtcs = getPointelRange( K, surfels[ i ] );
               for ( auto&& primal_vtx : primal_vtcs )
-                output << " " << vtx_numbering[ primal_vtx ];
-              output << std::endl;
-            }      
+                writer << " " << vtx_numbering.find( primal_vtx )->second;
+              writer << '\n';
+            } );
+          writer.flush();
           return output.good();
         }
     
@@ -2734,6 +3245,7 @@ namespace DGtal
           typedef unsigned long Size;
           BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
           BOOST_CONCEPT_ASSERT(( concepts::CCellEmbedder< TCellEmbedder > ));
+          BufferedStreamWriter writer( output );
           std::string dualFaceSubdivision = params[ "faceSubdivision" ].as<std::string>();
           const int   subdivide
           = dualFaceSubdivision == "Naive"    ? 1
@@ -2751,10 +3263,10 @@ namespace DGtal
                   vtx_numbering[ s ] = n++;
                   // Output vertex positions
                   RealPoint p = embedder( K.unsigns( s ) );
-                  output << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << std::endl;
+                  writer << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << '\n';
                 }
             }
-          auto faces = surface->allClosedFaces();
+          const auto faces = surface->allClosedFaceRange();
           // Prepare centroids if necessary
           if ( subdivide == 2 )
             {
@@ -2768,7 +3280,7 @@ namespace DGtal
                       RealPoint p = RealPoint::zero;
                       for ( auto&& s : vtcs ) p += embedder( K.unsigns( s ) );
                       p /= nv;
-                      output << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << std::endl;
+                      writer << "v " << p[ 0 ] << " " << p[ 1 ] << " " << p[ 2 ] << '\n';
                     }
                 }
             }
@@ -2777,12 +3289,12 @@ namespace DGtal
             { // No subdivision
               for ( auto&& f : faces )
                 {
-                  output << "f";
+                  writer << "f";
                   auto vtcs = surface->verticesAroundFace( f );
                   std::reverse( vtcs.begin(), vtcs.end() );
                   for ( auto&& s : vtcs )
-                    output << " " << vtx_numbering[ s ];
-                  output << std::endl;
+                    writer << " " << vtx_numbering[ s ];
+                  writer << '\n';
                 }
             }
           else if ( subdivide == 1 )
@@ -2792,9 +3304,9 @@ namespace DGtal
                   auto vtcs = surface->verticesAroundFace( f );
                   Size   nv = vtcs.size();
                   for ( Size i = 1; i < nv - 1; ++i )
-                    output << "f " << vtx_numbering[ vtcs[ 0 ] ]
+                    writer << "f " << vtx_numbering[ vtcs[ 0 ] ]
                            << " "  << vtx_numbering[ vtcs[ i+1 ] ]
-                           << " "  << vtx_numbering[ vtcs[ i ] ] << std::endl;
+                           << " "  << vtx_numbering[ vtcs[ i ] ] << '\n';
                 }
             }
           else if ( subdivide == 2 )
@@ -2804,31 +3316,36 @@ namespace DGtal
                   auto vtcs = surface->verticesAroundFace( f );
                   Size   nv = vtcs.size();
                   if ( nv == 3 )
-                    output << "f " << vtx_numbering[ vtcs[ 0 ] ]
+                    writer << "f " << vtx_numbering[ vtcs[ 0 ] ]
                            << " "  << vtx_numbering[ vtcs[ 2 ] ]
-                           << " "  << vtx_numbering[ vtcs[ 1 ] ] << std::endl;
+                           << " "  << vtx_numbering[ vtcs[ 1 ] ] << '\n';
                   else {
                     Size c = sub_numbering[ f ];
                     for ( Size i = 0; i < nv; ++i )
                       {
-                        output << "f " << c
+                        writer << "f " << c
                                << " "  << vtx_numbering[ vtcs[ (i+1)%nv ] ]
-                               << " "  << vtx_numbering[ vtcs[ i ] ] << std::endl;
+                               << " "  << vtx_numbering[ vtcs[ i ] ] << '\n';
                       }
                   }
                 }
             }
+          writer.flush();
           return output.good();
         }
     
 
       // -------------------- map I/O services ------------------------------------------
     public:
+      // The writers below write on any output (e.g. std::ostream or
+      // BufferedStreamWriter) which has an operator<< for numbers and
+      // strings.
       struct CellWriter {
-        void operator()( std::ostream& output, const KSpace& K, const Cell & cell )
+        template <typename TOutput>
+        void operator()( TOutput& output, const KSpace& K, const Cell & cell )
         {
           for ( Dimension d = 0; d < KSpace::dimension; ++d )
-            output << " " << K.sKCoord( cell, d );
+            output << " " << K.uKCoord( cell, d );
         }
       };
       struct CellReader {
@@ -2841,10 +3358,11 @@ namespace DGtal
         }
       };
       struct SCellWriter {
-        void operator()( std::ostream& output, const KSpace& K, const SCell & scell )
+        template <typename TOutput>
+        void operator()( TOutput& output, const KSpace& K, const SCell & scell )
         {
-          CellWriter::operator()( output, K, K.unsigns( scell ) );
-          output << " " << K.sSign( scell );
+          CellWriter()( output, K, K.unsigns( scell ) );
+          output << " " << ( K.sSign( scell ) ? 1 : 0 );
         }
       };
       struct SCellReader {
@@ -2861,11 +3379,13 @@ namespace DGtal
 
       template <typename Value>
         struct ValueWriter {
-          void operator()( std::ostream& output, const Value& v )
+          template <typename TOutput>
+          void operator()( TOutput& output, const Value& v )
           {
             output << " " << v;
           }
-          void operator()( std::ostream& output, const std::vector<Value>& vv )
+          template <typename TOutput>
+          void operator()( TOutput& output, const std::vector<Value>& vv )
           {
             for ( auto&& v : vv ) output << " " << v;
           }
@@ -2918,7 +3438,9 @@ namespace DGtal
       // @param[in]  anyMap the map associated a value to signed cells.
       // @param[in]  writer the writer that can write values on the ouput
       // stream, e.g. ValueWriter<double> to write double value or
-      // vector<double> values.
+      // vector<double> values. Lines may be formatted in parallel by
+      // blocks, each one into its own std::ostringstream (see
+      // formatRecords), hence \a writer must be callable concurrently.
       template <typename TSCellMap, typename TValueWriter>
         static
         bool outputSCellMapAsCSV
@@ -2927,13 +3449,19 @@ namespace DGtal
           const TSCellMap&     anyMap,
           const TValueWriter& writer )
       {
-        SCellWriter w;
-        for ( auto&& v : anyMap )
+        std::vector< typename TSCellMap::const_iterator > entries;
+        entries.reserve( anyMap.size() );
+        for ( auto it = anyMap.begin(), itE = anyMap.end(); it != itE; ++it )
+          entries.push_back( it );
+        formatRecords( output, entries.size(),
+                       [&] ( std::ostream& out, std::size_t i )
           {
-            w( output, K, v.first );
-            writer( output, v.second );
-            output << std::endl;
-          }
+            SCellWriter  w;
+            TValueWriter vw( writer );
+            w( out, K, entries[ i ]->first );
+            vw( out, entries[ i ]->second );
+            out << '\n';
+          } );
         return output.good();
       }
     
@@ -2948,7 +3476,8 @@ namespace DGtal
       // @param[in]  anyMap the map associated a value to signed cells.
       // @param[in]  writer the writer that can write values on the ouput
       // stream, e.g. ValueWriter<double> to write double value or
-      // vector<double> values.
+      // vector<double> values. It must be callable concurrently (see
+      // outputSCellMapAsCSV).
       template <typename TCellMap, typename TValueWriter>
         static
         bool outputCellMapAsCSV
@@ -2957,16 +3486,127 @@ namespace DGtal
           const TCellMap&      anyMap,
           const TValueWriter& writer )
       {
-        CellWriter w;
-        for ( auto&& v : anyMap )
+        std::vector< typename TCellMap::const_iterator > entries;
+        entries.reserve( anyMap.size() );
+        for ( auto it = anyMap.begin(), itE = anyMap.end(); it != itE; ++it )
+          entries.push_back( it );
+        formatRecords( output, entries.size(),
+                       [&] ( std::ostream& out, std::size_t i )
           {
-            w( output, K, v.first );
-            writer( output, v.second );
-            output << std::endl;
-          }
+            CellWriter   w;
+            TValueWriter vw( writer );
+            w( out, K, entries[ i ]->first );
+            vw( out, entries[ i ]->second );
+            out << '\n';
+          } );
         return output.good();
       }
     
+      /// Saves a range of surfels and some scalar and vector fields
+      /// defined on them as raw arrays, for numeric tools which read
+      /// binary data (e.g. numpy.fromfile). Each array is written into
+      /// its own file, in little-endian order whatever the host, and a
+      /// JSON file \a jsonfile describes them all:
+      ///
+      /// @code
+      /// { "byteOrder": "little", "count": 2454, "arrays": [
+      ///   { "name": "surfels", "file": "f.surfels.bin", "type": "int32", "components": 4 },
+      ///   { "name": "H", "file": "f.H.bin", "type": "float64", "components": 1 } ] }
+      /// @endcode
+      ///
+      /// The array "surfels" contains the Khalimsky coordinates of each
+      /// surfel followed by its sign (1 for positive, 0 for negative).
+      /// Array files are named after \a jsonfile without its extension,
+      /// followed by the name of the array and ".bin".
+      ///
+      /// @param[in] jsonfile the name of the JSON file.
+      /// @param[in] surfels the range of surfels (may be empty).
+      /// @param[in] scalar_fields the scalar fields with their names,
+      /// each one with one value per surfel.
+      /// @param[in] vector_fields the vector fields with their names,
+      /// each one with one vector per surfel.
+      /// @return 'true' if all files were written and all arrays have
+      /// the same number of elements.
+      static bool
+        saveBinaryFields
+        ( std::string jsonfile,
+          const SurfelRange& surfels,
+          const std::map< std::string, Scalars >&     scalar_fields,
+          const std::map< std::string, RealVectors >& vector_fields
+          = std::map< std::string, RealVectors >() )
+      {
+        std::string basename = jsonfile;
+        auto lastslash = jsonfile.find_last_of( "/\\" );
+        auto lastindex = jsonfile.find_last_of( "." );
+        if ( lastindex == std::string::npos
+             || ( lastslash != std::string::npos && lastindex < lastslash ) )
+          jsonfile = jsonfile + ".json";
+        else
+          basename = jsonfile.substr( 0, lastindex );
+        const std::string integer_type = std::string( "int" )
+          + std::to_string( 8 * sizeof( Integer ) );
+        std::size_t count = surfels.size();
+        if ( surfels.empty() && ! scalar_fields.empty() )
+          count = scalar_fields.begin()->second.size();
+        else if ( surfels.empty() && ! vector_fields.empty() )
+          count = vector_fields.begin()->second.size();
+        std::ofstream output( jsonfile.c_str() );
+        BufferedStreamWriter json( output );
+        json << "{\n  \"byteOrder\": \"little\",\n  \"count\": " << count
+             << ",\n  \"arrays\": [";
+        const char* sep = "\n";
+        auto describe = [&] ( const std::string& name, const std::string& type,
+                              std::size_t components )
+          {
+            const std::string file = basename + "." + name + ".bin";
+            auto slash = file.find_last_of( "/\\" );
+            json << sep << "    { \"name\": \"" << name << "\", \"file\": \""
+                 << ( slash == std::string::npos ? file : file.substr( slash + 1 ) )
+                 << "\", \"type\": \"" << type
+                 << "\", \"components\": " << components << " }";
+            sep = ",\n";
+            return file;
+          };
+        bool ok = true;
+        if ( ! surfels.empty() )
+          {
+            std::ofstream out( describe( "surfels", integer_type, Space::dimension + 1 ).c_str(),
+                               std::ios::binary );
+            BufferedStreamWriter writer( out );
+            for ( auto&& s : surfels )
+              {
+                for ( Dimension k = 0; k < Space::dimension; ++k )
+                  writeLittleEndian( writer, s.preCell().coordinates[ k ] );
+                writeLittleEndian( writer, (Integer) ( s.preCell().positive ? 1 : 0 ) );
+              }
+            writer.flush();
+            ok = ok && out.good();
+          }
+        for ( auto&& field : scalar_fields )
+          {
+            std::ofstream out( describe( field.first, "float64", 1 ).c_str(),
+                               std::ios::binary );
+            BufferedStreamWriter writer( out );
+            for ( auto x : field.second ) writeLittleEndian( writer, (double) x );
+            writer.flush();
+            ok = ok && count == field.second.size() && out.good();
+          }
+        for ( auto&& field : vector_fields )
+          {
+            std::ofstream out( describe( field.first, "float64", Space::dimension ).c_str(),
+                               std::ios::binary );
+            BufferedStreamWriter writer( out );
+            for ( auto&& v : field.second )
+              for ( Dimension k = 0; k < Space::dimension; ++k )
+                writeLittleEndian( writer, (double) v[ k ] );
+            writer.flush();
+            ok = ok && count == field.second.size() && out.good();
+          }
+        json << "\n  ]\n}\n";
+        json.flush();
+        return ok && output.good();
+      }
+
       /// Given a space \a K and an oriented cell \a s, returns its vertices.
       /// @param K any cellular grid space.
       /// @param s any signed cell.
@@ -3090,6 +3730,196 @@ namespace DGtal
       // ------------------------- Internals ------------------------------------
     private:
 
+      /// Transforms the coordinates of a point so that interleaving
+      /// their bits gives its index along a Hilbert curve (J. Skilling,
+      /// "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004).
+      /// The coordinates are reversed, since the Morton class puts the
+      /// bits of the last coordinate first.
+      ///
+      /// @param[in] p a point with non-negative coordinates smaller than 2^bits.
+      /// @param[in] bits the number of bits of each coordinate (at least 1).
+      /// @return the transposed Hilbert index of \a p.
+      static Point
+      getHilbertTransposedCoordinates( const Point& p, unsigned int bits )
+      {
+        typedef DGtal::uint64_t Word;
+        const Dimension dim = KSpace::dimension;
+        Word X[ dim ];
+        for ( Dimension k = 0; k < dim; ++k ) X[ k ] = static_cast<Word>( p[ k ] );
+        const Word M = Word( 1 ) << ( bits - 1 );
+        // Inverse undo excess work.
+        for ( Word Q = M; Q > 1; Q >>= 1 )
+          {
+            const Word P = Q - 1;
+            for ( Dimension i = 0; i < dim; ++i )
+              if ( X[ i ] & Q ) X[ 0 ] ^= P;
+              else
+                {
+                  const Word t = ( X[ 0 ] ^ X[ i ] ) & P;
+                  X[ 0 ] ^= t;
+                  X[ i ] ^= t;
+                }
+          }
+        // Gray encode.
+        for ( Dimension i = 1; i < dim; ++i ) X[ i ] ^= X[ i - 1 ];
+        Word t = 0;
+        for ( Word Q = M; Q > 1; Q >>= 1 )
+          if ( X[ dim - 1 ] & Q ) t ^= Q - 1;
+        Point q;
+        for ( Dimension k = 0; k < dim; ++k )
+          q[ dim - 1 - k ] = static_cast<typename Point::Coordinate>( X[ k ] ^ t );
+        return q;
+      }
+
+      /// Formats the records 0 to \a n-1 into \a writer, where \a
+      /// format( w, i ) formats the i-th record into the writer \a w.
+      /// With several threads (OpenMP), blocks of records are formatted
+      /// in parallel into separate buffers, which are then written in
+      /// order. Hence \a format must be callable concurrently.
+      template <typename TFormat>
+      static void
+      formatRecords( BufferedStreamWriter& writer, std::size_t n, TFormat format )
+      {
+        const std::size_t block      = 4096;
+        const std::size_t nb_blocks  = ( n + block - 1 ) / block;
+#ifdef WITH_OPENMP
+        const std::size_t nb_threads = static_cast<std::size_t>( omp_get_max_threads() );
+#else
+        const std::size_t nb_threads = 1;
+#endif
+        if ( nb_threads == 1 || nb_blocks <= 1 )
+          {
+            for ( std::size_t i = 0; i < n; ++i ) format( writer, i );
+            return;
+          }
+        // At most 'group' blocks are stored at once.
+        const std::size_t group = 4 * nb_threads;
+        std::vector< std::string > texts( group );
+        for ( std::size_t g = 0; g < nb_blocks; g += group )
+          {
+            const std::ptrdiff_t m = std::min( group, nb_blocks - g );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+            for ( std::ptrdiff_t k = 0; k < m; ++k )
+              {
+                std::ostringstream   text;
+                BufferedStreamWriter w( text );
+                w.setPrecision( writer.precision() );
+                const std::size_t b = ( g + k ) * block;
+                const std::size_t e = std::min( n, b + block );
+                for ( std::size_t i = b; i < e; ++i ) format( w, i );
+                w.flush();
+                texts[ k ] = text.str();
+              }
+            for ( std::ptrdiff_t k = 0; k < m; ++k )
+              writer.write( texts[ k ].data(), texts[ k ].size() );
+          }
+      }
+
+      /// Formats the records 0 to \a n-1 into \a output, where \a
+      /// format( out, i ) formats the i-th record into the std::ostream
+      /// \a out. Same as above, but blocks are formatted into
+      /// std::ostringstream objects with the format flags of \a output,
+      /// so that \a format may be any std::ostream based writer.
+      template <typename TFormat>
+      static void
+      formatRecords( std::ostream& output, std::size_t n, TFormat format )
+      {
+        const std::size_t block      = 4096;
+        const std::size_t nb_blocks  = ( n + block - 1 ) / block;
+#ifdef WITH_OPENMP
+        const std::size_t nb_threads = static_cast<std::size_t>( omp_get_max_threads() );
+#else
+        const std::size_t nb_threads = 1;
+#endif
+        if ( nb_threads == 1 || nb_blocks <= 1 )
+          {
+            for ( std::size_t i = 0; i < n; ++i ) format( output, i );
+            return;
+          }
+        // At most 'group' blocks are stored at once.
+        const std::size_t group = 4 * nb_threads;
+        std::vector< std::string > texts( group );
+        for ( std::size_t g = 0; g < nb_blocks; g += group )
+          {
+            const std::ptrdiff_t m = std::min( group, nb_blocks - g );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+            for ( std::ptrdiff_t k = 0; k < m; ++k )
+              {
+                std::ostringstream text;
+                text.flags( output.flags() );
+                text.precision( output.precision() );
+                const std::size_t b = ( g + k ) * block;
+                const std::size_t e = std::min( n, b + block );
+                for ( std::size_t i = b; i < e; ++i ) format( text, i );
+                texts[ k ] = text.str();
+              }
+            for ( std::ptrdiff_t k = 0; k < m; ++k )
+              output.write( texts[ k ].data(), texts[ k ].size() );
+          }
+      }
+
+      /// Writes the bytes of \a x in little-endian order.
+      template <typename T>
+      static void
+      writeLittleEndian( BufferedStreamWriter& writer, T x )
+      {
+        if ( BufferedStreamWriter::isLittleEndian() )
+          writer.writeBinary( x );
+        else
+          {
+            char bytes[ sizeof( T ) ];
+            std::memcpy( bytes, &x, sizeof( T ) );
+            std::reverse( bytes, bytes + sizeof( T ) );
+            writer.write( bytes, sizeof( T ) );
+          }
+      }
+
+      /// Gives the surfels of the range [it,itE) by chunks of \a
+      /// chunk_size surfels to the function \a f. The next chunk is
+      /// extracted while \a f processes the current one when several
+      /// threads are available.
+      /// @return the number of surfels.
+      template <typename TSurfelIterator, typename TChunkFunction>
+      static std::size_t
+      pipeSurfelChunks( TSurfelIterator it, TSurfelIterator itE,
+                        const std::size_t chunk_size, TChunkFunction& f )
+      {
+        std::size_t nb = 0;
+        auto fill = [&] ( SurfelRange& chunk )
+          {
+            chunk.clear();
+            for ( ; chunk.size() < chunk_size && it != itE; ++it )
+              chunk.push_back( *it );
+            nb += chunk.size();
+          };
+        SurfelRange current, next;
+        current.reserve( chunk_size );
+        next.reserve( chunk_size );
+        fill( current );
+        while ( ! current.empty() )
+          {
+#ifdef WITH_OPENMP
+            const bool pipelined = omp_get_max_threads() > 1;
+#pragma omp parallel sections num_threads(2) if(pipelined)
+            {
+#pragma omp section
+              fill( next );
+#pragma omp section
+              f( current );
+            }
+#else
+            fill( next );
+            f( current );
+#endif
+            current.swap( next );
+          }
+        return nb;
+      }
+
     }; // end of class Shortcuts
 
 
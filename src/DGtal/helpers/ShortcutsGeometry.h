@@ -82,6 +82,14 @@ namespace DGtal
       using Base::parametersKSpace;
       using Base::getKSpace;
       using Base::parametersDigitizedImplicitShape3D;
+      using Base::parametersCache;
+      using Base::getCacheKey;
+      using Base::saveCachedScalars;
+      using Base::loadCachedScalars;
+      using Base::saveCachedRealVectors;
+      using Base::loadCachedRealVectors;
+      using Base::parametersDigitalSurface;
+      using Base::traverseSurfelChunks;
 
       // ----------------------- Usual space types --------------------------------------
     public:
@@ -116,8 +124,9 @@ namespace DGtal
       typedef ImplicitPolynomial3Shape<Space>              ImplicitShape3D;
       /// defines the digitization of an implicit shape.
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
-      /// defines a black and white image with (hyper-)rectangular domain.
-      typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      /// defines a black and white image with (hyper-)rectangular
+      /// domain, packed with one bit per point.
+      typedef PackedBinaryImage<Domain>                    BinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -629,6 +638,39 @@ namespace DGtal
         return getIINormalVectors( *bimage, K, surfels, params );
       }
 
+      /// Same as getIINormalVectors( bimage, surfels, params ), but
+      /// reads the normals from the cache when they have already been
+      /// estimated with the same image, surfels and parameters.
+      /// Otherwise, the estimated normals are written into the cache.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the normals
+      /// @param[in] params the parameters of getIINormalVectors, and:
+      ///   - cacheDirectory [ "." ]: the directory where cached data are written and read.
+      ///
+      /// @return the vector containing the estimated normals, in the
+      /// same order as \a surfels.
+      static RealVectors
+        getCachedIINormalVectors( CountedPtr<BinaryImage> bimage,
+                                  const SurfelRange&      surfels,
+                                  const Parameters&       params
+                                  = parametersGeometryEstimation()
+                                  | parametersKSpace()
+                                  | parametersCache() )
+      {
+        const std::string filename = params[ "cacheDirectory" ].as<std::string>()
+          + "/" + getCacheKey( bimage, params, "IINormalVectors", surfels ) + ".vectors";
+        RealVectors normals;
+        if ( loadCachedRealVectors( normals, filename )
+             && normals.size() == surfels.size() )
+          return normals;
+        normals = getIINormalVectors( bimage, surfels, params );
+        if ( ! saveCachedRealVectors( normals, filename ) )
+          trace.warning() << "[ShortcutsGeometry::getCachedIINormalVectors]"
+                          << " Unable to write cache file " << filename << std::endl;
+        return normals;
+      }
+
       /// Given a digitized implicit shape \a dshape, a sequence of \a surfels,
       /// and some parameters \a params, returns the normal Integral
       /// Invariant (II) estimation at the specified surfels, in the
@@ -762,6 +804,155 @@ namespace DGtal
         return getIIMeanCurvatures( *bimage, K, surfels, params );
       }
 
+      /// Same as getIIMeanCurvatures( bimage, surfels, params ), but
+      /// reads the mean curvatures from the cache when they have
+      /// already been estimated with the same image, surfels and
+      /// parameters. Otherwise, the estimated mean curvatures are
+      /// written into the cache.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surfels the sequence of surfels at which we compute the mean curvatures
+      /// @param[in] params the parameters of getIIMeanCurvatures, and:
+      ///   - cacheDirectory [ "." ]: the directory where cached data are written and read.
+      ///
+      /// @return the vector containing the estimated mean curvatures, in the
+      /// same order as \a surfels.
+      static Scalars
+        getCachedIIMeanCurvatures( CountedPtr<BinaryImage> bimage,
+                                   const SurfelRange&      surfels,
+                                   const Parameters&       params
+                                   = parametersGeometryEstimation()
+                                   | parametersKSpace()
+                                   | parametersCache() )
+      {
+        const std::string filename = params[ "cacheDirectory" ].as<std::string>()
+          + "/" + getCacheKey( bimage, params, "IIMeanCurvatures", surfels ) + ".scalars";
+        Scalars curvatures;
+        if ( loadCachedScalars( curvatures, filename )
+             && curvatures.size() == surfels.size() )
+          return curvatures;
+        curvatures = getIIMeanCurvatures( bimage, surfels, params );
+        if ( ! saveCachedScalars( curvatures, filename ) )
+          trace.warning() << "[ShortcutsGeometry::getCachedIIMeanCurvatures]"
+                          << " Unable to write cache file " << filename << std::endl;
+        return curvatures;
+      }
+
+      /// Given a digital shape \a bimage and one of its digital
+      /// surfaces \a surface, estimates the normal Integral Invariant
+      /// (II) at each surfel, chunk by chunk along the traversal of the
+      /// surface (see traverseSurfelChunks). Neither the surfels nor
+      /// the normals of the whole surface are stored: each chunk of
+      /// surfels and its normals are given to \a sink, which may for
+      /// instance write them. The next chunk of surfels is extracted
+      /// while the current one is estimated when several threads are
+      /// available.
+      ///
+      /// @tparam TDigitalSurfaceContainer either kind of DigitalSurfaceContainer
+      /// @tparam TSink the type of a function `void( const SurfelRange&, const RealVectors& )`.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surface a smart pointer on a (light or not) digital surface of \a bimage.
+      /// @param[in] sink the function called on each chunk of surfels and its normals.
+      /// @param[in] params the parameters of getIINormalVectors, and:
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst", the order of the surfels.
+      ///   - chunkSize         [    65536]: the (maximal) number of surfels of each chunk.
+      ///
+      /// @return the number of surfels.
+      ///
+      /// @note Normals are reoriented with respect to Trivial normals,
+      /// as in getIINormalVectors, so that both give the same normals.
+      template <typename TDigitalSurfaceContainer, typename TSink>
+        static std::size_t
+        streamIINormalVectors
+        ( CountedPtr<BinaryImage> bimage,
+          CountedPtr< ::DGtal::DigitalSurface<TDigitalSurfaceContainer> > surface,
+          TSink                   sink,
+          const Parameters&       params
+          = parametersGeometryEstimation()
+          | parametersKSpace()
+          | parametersDigitalSurface() )
+        {
+          typedef functors::IINormalDirectionFunctor<Space> IINormalFunctor;
+          typedef IntegralInvariantCovarianceEstimator
+            <KSpace, BinaryImage, IINormalFunctor>              IINormalEstimator;
+
+          const KSpace& K = surface->container().space();
+          Scalar   h       = params[ "gridstep"  ].as<Scalar>();
+          Scalar   r       = params[ "r-radius"  ].as<Scalar>();
+          Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+          IINormalFunctor     functor;
+          functor.init( h, r*h );
+          IINormalEstimator   ii_estimator( functor );
+          ii_estimator.attach( K, *bimage );
+          ii_estimator.setParams( r );
+          const SurfelRange no_surfels;
+          ii_estimator.init( h, no_surfels.begin(), no_surfels.end() );
+          RealVectors n_estimations;
+          return traverseSurfelChunks( surface, [&] ( const SurfelRange& surfels )
+            {
+              n_estimations.clear();
+              ii_estimator.eval( surfels.begin(), surfels.end(),
+                                 std::back_inserter( n_estimations ) );
+              orientVectors( n_estimations, getTrivialNormalVectors( K, surfels ) );
+              sink( surfels, n_estimations );
+            }, params );
+        }
+
+      /// Given a digital shape \a bimage and one of its digital
+      /// surfaces \a surface, estimates the mean curvature Integral
+      /// Invariant (II) at each surfel, chunk by chunk along the
+      /// traversal of the surface (see streamIINormalVectors).
+      ///
+      /// @tparam TDigitalSurfaceContainer either kind of DigitalSurfaceContainer
+      /// @tparam TSink the type of a function `void( const SurfelRange&, const Scalars& )`.
+      ///
+      /// @param[in] bimage the characteristic function of the shape as a binary image (inside is true, outside is false).
+      /// @param[in] surface a smart pointer on a (light or not) digital surface of \a bimage.
+      /// @param[in] sink the function called on each chunk of surfels and its mean curvatures.
+      /// @param[in] params the parameters of getIIMeanCurvatures, and:
+      ///   - surfaceTraversal  ["Default"]: "Default"|"DepthFirst"|"BreadthFirst", the order of the surfels.
+      ///   - chunkSize         [    65536]: the (maximal) number of surfels of each chunk.
+      ///
+      /// @return the number of surfels.
+      template <typename TDigitalSurfaceContainer, typename TSink>
+        static std::size_t
+        streamIIMeanCurvatures
+        ( CountedPtr<BinaryImage> bimage,
+          CountedPtr< ::DGtal::DigitalSurface<TDigitalSurfaceContainer> > surface,
+          TSink                   sink,
+          const Parameters&       params
+          = parametersGeometryEstimation()
+          | parametersKSpace()
+          | parametersDigitalSurface() )
+        {
+          typedef functors::IIMeanCurvature3DFunctor<Space> IIMeanCurvFunctor;
+          typedef IntegralInvariantVolumeEstimator
+            <KSpace, BinaryImage, IIMeanCurvFunctor>        IIMeanCurvEstimator;
+
+          const KSpace& K = surface->container().space();
+          Scalar   h       = params[ "gridstep"  ].as<Scalar>();
+          Scalar   r       = params[ "r-radius"  ].as<Scalar>();
+          Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
+          IIMeanCurvFunctor   functor;
+          functor.init( h, r*h );
+          IIMeanCurvEstimator ii_estimator( functor );
+          ii_estimator.attach( K, *bimage );
+          ii_estimator.setParams( r );
+          const SurfelRange no_surfels;
+          ii_estimator.init( h, no_surfels.begin(), no_surfels.end() );
+          Scalars mc_estimations;
+          return traverseSurfelChunks( surface, [&] ( const SurfelRange& surfels )
+            {
+              mc_estimations.clear();
+              ii_estimator.eval( surfels.begin(), surfels.end(),
+                                 std::back_inserter( mc_estimations ) );
+              sink( surfels, mc_estimations );
+            }, params );
+        }
+
       /// Given a digitized implicit shape \a dshape, a sequence of \a surfels,
       /// and some parameters \a params, returns the mean curvature Integral
       /// Invariant (II) estimation at the specified surfels, in the
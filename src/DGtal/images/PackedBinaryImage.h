@@ -0,0 +1,315 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedBinaryImage.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PackedBinaryImage.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedBinaryImage_RECURSES)
+#error Recursive header files inclusion detected in PackedBinaryImage.h
+#else // defined(PackedBinaryImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedBinaryImage_RECURSES
+
+#if !defined PackedBinaryImage_h
+/** Prevents repeated inclusion of headers. */
+#define PackedBinaryImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedBinaryImage
+  /**
+   * Description of template class 'PackedBinaryImage' <p>
+   * \brief Aim: Model of concepts::CImage storing a binary image on
+   * a (hyper-)rectangular domain with one bit per point, in explicit
+   * 64-bit words.
+   *
+   * Points are grouped in rows along the first axis, and each row
+   * starts on a new word (the unused bits at the end of a row are
+   * always zero). Hence, two points of different rows never share a
+   * word, and rows may be written concurrently with setValue. Points
+   * of a same row may be written concurrently with setValueAtomic.
+   *
+   * Compared to ImageContainerBySTLVector<Domain,bool>, accesses do
+   * not go through the proxy of std::vector<bool>, the image is
+   * filled row by row in parallel from any point predicate with
+   * assign, and boolean operations and volume (count) are computed
+   * word by word.
+   *
+   * @code
+   * typedef PackedBinaryImage< Z3i::Domain > BinaryImage;
+   * BinaryImage image( domain );
+   * image.assign( [&] ( const Z3i::Point& p ) { return p.norm() <= 10.0; } );
+   * std::cout << image.count() << " points." << std::endl;
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   *
+   * @see testPackedBinaryImage.cpp
+   */
+  template <typename TDomain>
+  class PackedBinaryImage
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef PackedBinaryImage<TDomain> Self;
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+    typedef bool Value;
+    typedef DGtal::uint64_t Word;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// static constants
+    static const Dimension dimension = Domain::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~PackedBinaryImage();
+
+    /**
+     * Constructor.
+     * @param aDomain the domain of the image.
+     * @param aValue the value of every point of the image.
+     */
+    PackedBinaryImage( const Domain & aDomain, Value aValue = false );
+
+    /**
+     * @pre the point must be in the domain.
+     * @param aPoint any point of the domain.
+     * @return the value at \a aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Sets the value at a point. Points of different rows may be set
+     * concurrently.
+     *
+     * @pre the point must be in the domain.
+     * @param aPoint any point of the domain.
+     * @param aValue the new value at \a aPoint.
+     */
+    void setValue( const Point & aPoint, Value aValue );
+
+    /**
+     * Sets the value at a point with an atomic operation on its word,
+     * so that any points may be set concurrently.
+     *
+     * @pre the point must be in the domain.
+     * @param aPoint any point of the domain.
+     * @param aValue the new value at \a aPoint.
+     */
+    void setValueAtomic( const Point & aPoint, Value aValue );
+
+    /// @return the domain of the image.
+    const Domain & domain() const;
+
+    /// @return the number of points of the domain along each axis.
+    Vector extent() const;
+
+    /// @return the range of the values, in the order of the domain.
+    ConstRange constRange() const;
+
+    /// @return the range providing output iterators on the values.
+    Range range();
+
+    /// @return an output iterator that sets values in the order of the domain.
+    OutputIterator outputIterator();
+
+    /**
+     * Sets every point to the same value.
+     * @param aValue the new value of every point.
+     */
+    void fill( Value aValue );
+
+    /**
+     * Sets each point to the value of the given predicate at this
+     * point. Rows are computed in parallel (with OpenMP), and each
+     * word is written once.
+     *
+     * @tparam TPointPredicate any model of concepts::CPointPredicate
+     * whose operator() may be called concurrently.
+     * @param aPredicate any predicate on the points of the domain.
+     */
+    template <typename TPointPredicate>
+    void assign( const TPointPredicate & aPredicate );
+
+    /// @return the number of points whose value is 'true'.
+    Size count() const;
+
+    /**
+     * Replaces the image by its union with another image.
+     * @pre \a other has the same domain.
+     * @param other any image with the same domain.
+     * @return a reference to this.
+     */
+    Self & operator|=( const Self & other );
+
+    /**
+     * Replaces the image by its intersection with another image.
+     * @pre \a other has the same domain.
+     * @param other any image with the same domain.
+     * @return a reference to this.
+     */
+    Self & operator&=( const Self & other );
+
+    /**
+     * Replaces the image by its symmetric difference with another image.
+     * @pre \a other has the same domain.
+     * @param other any image with the same domain.
+     * @return a reference to this.
+     */
+    Self & operator^=( const Self & other );
+
+    /**
+     * Replaces the image by its difference with another image.
+     * @pre \a other has the same domain.
+     * @param other any image with the same domain.
+     * @return a reference to this.
+     */
+    Self & operator-=( const Self & other );
+
+    /// Replaces each value by its negation.
+    void complement();
+
+    /// @return the number of rows, i.e. the number of points of the
+    /// domain divided by its extent along the first axis.
+    Size nbRows() const;
+
+    /// @return the number of words of each row.
+    Size nbWordsPerRow() const;
+
+    /// @return the words storing the image, row after row (point
+    /// (x,row) is the bit (x%64) of the word row*nbWordsPerRow()+x/64).
+    const std::vector<Word> & words() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The domain of the image.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The number of rows.
+    Size myNbRows;
+    /// The number of words of each row.
+    Size myWordsPerRow;
+    /// The mask of the used bits of the last word of each row.
+    Word myLastWordMask;
+    /// The words, row after row.
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point of the domain.
+     * @param[out] bit the position of the point in its word.
+     * @return the index of the word storing the point.
+     */
+    Size wordIndex( const Point & aPoint, unsigned int & bit ) const;
+
+    /**
+     * @param row any row.
+     * @return the first point of the row.
+     */
+    Point rowFirstPoint( Size row ) const;
+
+    /// Sets to zero the unused bits of the last word of each row.
+    void clearPadding();
+
+  }; // end of class PackedBinaryImage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedBinaryImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedBinaryImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedBinaryImage<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/PackedBinaryImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedBinaryImage_h
+
+#undef PackedBinaryImage_RECURSES
+#endif // else defined(PackedBinaryImage_RECURSES)
@@ -0,0 +1,336 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BufferedStreams.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BufferedStreams.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BufferedStreams_RECURSES)
+#error Recursive header files inclusion detected in BufferedStreams.h
+#else // defined(BufferedStreams_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BufferedStreams_RECURSES
+
+#if !defined BufferedStreams_h
+/** Prevents repeated inclusion of headers. */
+#define BufferedStreams_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class BufferedStreamWriter
+  /**
+   * Description of class 'BufferedStreamWriter' <p>
+   * \brief Aim: Fast, buffered and locale-independent formatting of
+   * numbers and strings (and raw binary values) into an output
+   * stream.
+   *
+   * Values are formatted into an internal buffer, which is written
+   * into the stream when it is full, when flush() is called, or at
+   * destruction. Integers are formatted without any call to the C or
+   * C++ library. Floating-point numbers are formatted like the
+   * default format of std::ostream (i.e. \c "%g" with the precision
+   * of the stream), always with a dot as decimal separator. Hence
+   * replacing `out << x` by `writer << x` produces the same
+   * characters, without the cost of std::ostream formatting and of
+   * the flushes of std::endl.
+   *
+   * @code
+   * std::ofstream out( "mesh.obj" );
+   * BufferedStreamWriter writer( out );
+   * writer << "v " << p[ 0 ] << ' ' << p[ 1 ] << ' ' << p[ 2 ] << '\n';
+   * @endcode
+   *
+   * @note The stream must not be used directly while a writer is
+   * attached to it, unless flush() is called before.
+   *
+   * @see BufferedStreamReader
+   */
+  class BufferedStreamWriter
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef BufferedStreamWriter Self;
+
+    /**
+     * Constructor.
+     * @param out the output stream where characters are written.
+     * @param capacity the size of the internal buffer.
+     */
+    BufferedStreamWriter( std::ostream& out, std::size_t capacity = 1 << 16 );
+
+    /**
+     * Destructor. Flushes the buffer.
+     */
+    ~BufferedStreamWriter();
+
+    /// Writes the buffer into the stream.
+    void flush();
+
+    /// @return 'true' if the stream is good.
+    bool good() const;
+
+    /// @return the number of significant digits of floating-point numbers.
+    int precision() const;
+
+    /**
+     * Sets the number of significant digits of floating-point
+     * numbers (initialized with the precision of the stream).
+     * @param prec the precision.
+     */
+    void setPrecision( int prec );
+
+    /// Writes a character.
+    Self& operator<<( char c );
+    /// Writes a null-terminated string.
+    Self& operator<<( const char* s );
+    /// Writes a string.
+    Self& operator<<( const std::string& s );
+    /// Writes a floating-point number.
+    Self& operator<<( double x );
+    /// Writes a floating-point number.
+    Self& operator<<( float x );
+
+    /**
+     * Writes an integer.
+     * @tparam TInteger any integral type.
+     * @param x the integer.
+     * @return a reference on 'this'.
+     */
+    template <typename TInteger>
+    typename std::enable_if< std::is_integral<TInteger>::value, Self& >::type
+    operator<<( TInteger x );
+
+    /**
+     * Writes \a n raw bytes.
+     * @param data the bytes.
+     * @param n the number of bytes.
+     */
+    void write( const char* data, std::size_t n );
+
+    /**
+     * Writes the bytes of a value of arithmetic type, in the
+     * endianness of the host (see isLittleEndian).
+     * @tparam T any arithmetic type.
+     * @param x the value.
+     */
+    template <typename T>
+    void writeBinary( const T& x );
+
+    /// @return 'true' if the host is little endian.
+    static bool isLittleEndian();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The output stream.
+    std::ostream& myStream;
+    /// The buffer.
+    std::vector<char> myBuffer;
+    /// The number of characters in the buffer.
+    std::size_t mySize;
+    /// The number of significant digits of floating-point numbers.
+    int myPrecision;
+    /// 10^myPrecision, to detect integral values formatted as integers.
+    double myIntegralBound;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    BufferedStreamWriter( const BufferedStreamWriter & other );
+    BufferedStreamWriter & operator= ( const BufferedStreamWriter & other );
+
+    /// Makes sure that \a n characters can be appended to the buffer.
+    void reserve( std::size_t n );
+
+    /// Formats the unsigned integer \a x at the end of the buffer.
+    void writeUnsigned( unsigned long long x );
+
+  }; // end of class BufferedStreamWriter
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class BufferedStreamReader
+  /**
+   * Description of class 'BufferedStreamReader' <p>
+   * \brief Aim: Fast and locale-independent parsing of numbers (and
+   * raw binary values) from the whole content of an input stream,
+   * read at once in memory.
+   *
+   * Numbers are read like `in >> x` (i.e. leading whitespaces,
+   * newlines included, are skipped), and lines may be skipped or
+   * extracted, which is what is needed for the parsing of text
+   * formats like OFF, OBJ or ASCII PLY. Floating-point numbers are
+   * exactly converted when their mantissa has at most 15 digits and
+   * their exponent is small (which is the case of numbers written
+   * with the default precision), otherwise the conversion is
+   * delegated to a classic-locale std::istringstream.
+   *
+   * @see BufferedStreamWriter
+   */
+  class BufferedStreamReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Reads the remaining content of the stream.
+     * @param in any input stream.
+     */
+    BufferedStreamReader( std::istream& in );
+
+    /**
+     * Constructor from characters already in memory, which are not
+     * copied (hence they must outlive the reader).
+     * @param begin the first character.
+     * @param end the end of the characters.
+     */
+    BufferedStreamReader( const char* begin, const char* end );
+
+    /**
+     * Reads the remaining content of a stream, with a single read
+     * when the stream is seekable.
+     * @param in any input stream.
+     * @param[out] data the content of the stream.
+     */
+    static void readAll( std::istream& in, std::string& data );
+
+    /// @return 'true' if the whole content has been read.
+    bool eof() const;
+
+    /// @return 'true' if no read has failed.
+    bool good() const;
+
+    /// @return the next character, or 0 at the end.
+    char peek() const;
+
+    /// Skips spaces, tabulations and carriage returns, but not newlines.
+    void skipSpaces();
+
+    /// Skips all whitespaces, newlines included.
+    void skipWhitespaces();
+
+    /// Skips the rest of the current line, its newline included.
+    void skipLine();
+
+    /**
+     * Extracts the rest of the current line (without its newline nor
+     * a trailing carriage return).
+     * @param[out] line the line.
+     * @return 'false' if the end was already reached.
+     */
+    bool getLine( std::string& line );
+
+    /// @return 'true' if only spaces remain on the current line.
+    bool atEndOfLine();
+
+    /**
+     * Extracts the next word (i.e. the characters up to the next
+     * whitespace), after skipping whitespaces.
+     * @param[out] word the word.
+     * @return 'false' if the end was reached before any word.
+     */
+    bool readWord( std::string& word );
+
+    /// Skips the characters up to the next whitespace.
+    void skipWord();
+
+    /**
+     * Reads a number, after skipping whitespaces.
+     * @tparam T any arithmetic type.
+     * @param[out] x the number.
+     * @return 'false' if no number could be read (the position is
+     * then unchanged, and good() becomes 'false').
+     */
+    template <typename T>
+    bool read( T& x );
+
+    /**
+     * Reads the bytes of a value of arithmetic type.
+     * @tparam T any arithmetic type.
+     * @param[out] x the value.
+     * @param swapBytes when 'true', the byte order is reversed.
+     * @return 'false' if the end was reached.
+     */
+    template <typename T>
+    bool readBinary( T& x, bool swapBytes = false );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The content of the stream (empty if the characters are not owned).
+    std::string myData;
+    /// The position of the next character.
+    const char* myCurrent;
+    /// The end of the content.
+    const char* myEnd;
+    /// 'false' if some read has failed.
+    bool myGood;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    BufferedStreamReader( const BufferedStreamReader & other );
+    BufferedStreamReader & operator= ( const BufferedStreamReader & other );
+
+    /// Reads a signed integer.
+    bool readInteger( long long& x );
+    /// Reads an unsigned integer.
+    bool readUnsigned( unsigned long long& x );
+    /// Reads a floating-point number.
+    bool readReal( double& x );
+
+    /// Reads an integral number.
+    template <typename T>
+    bool readDispatch( T& x, std::true_type );
+    /// Reads a floating-point number.
+    template <typename T>
+    bool readDispatch( T& x, std::false_type );
+
+  }; // end of class BufferedStreamReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/BufferedStreams.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BufferedStreams_h
+
+#undef BufferedStreams_RECURSES
+#endif // else defined(BufferedStreams_RECURSES)
@@ -41,9 +41,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <string>
+#include <vector>
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/BufferedStreams.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -57,8 +60,12 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
- * into accouts the optional color faces.
+ * OFF, OFS, OBJ and PLY (ASCII or binary) surface mesh. It allows to
+ * import a Mesh object and takes into accouts the optional color faces.
+ *
+ * Files are read at once in memory and parsed with a
+ * BufferedStreamReader, which is much faster than formatted
+ * std::istream extraction and does not depend on the global locale.
  * 
  * The importation can be done automatically according the input file
  * extension with the operator << 
@@ -126,6 +133,93 @@ public:
   
   static  bool  importOFSFile(const std::string & filename, 
 			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false, double scale=1.0);
+
+
+ /** 
+  * Main method to import OBJ meshes file (Wavefront). Only the
+  * vertices ('v') and the faces ('f') are imported, texture and
+  * normal indices of faces (i.e. "f 1/1/1 ...") and materials are
+  * ignored. Negative (relative) indices are supported.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported.
+  */
+  
+  static  bool  importOBJFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+
+
+ /** 
+  * Main method to import PLY meshes file (Stanford polygon format),
+  * either ASCII, binary little endian or binary big endian. The
+  * properties x, y and z of the 'vertex' element and the list
+  * property vertex_indices (or vertex_index) of the 'face' element
+  * are imported, as well as the face colors if the 'face' element
+  * has red, green and blue (and optionally alpha) properties. Other
+  * properties and elements are ignored.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported.
+  */
+  
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false);
+
+
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /// The type of the coordinates of the points.
+  typedef typename std::decay< decltype( std::declval<TPoint&>()[ 0 ] ) >::type Component;
+
+  /// The scalar types of PLY properties.
+  enum PLYType { PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16,
+                 PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64, PLY_UNKNOWN };
+
+  /// A property of a PLY element.
+  struct PLYProperty
+  {
+    std::string name;   ///< its name
+    PLYType type;       ///< the type of the value or of the list items
+    bool isList;        ///< true if it is a list property
+    PLYType countType;  ///< the type of the size of a list
+  };
+
+  /// An element of a PLY file.
+  struct PLYElement
+  {
+    std::string name;                     ///< its name
+    std::size_t count;                    ///< its number of items
+    std::vector<PLYProperty> properties;  ///< its properties
+  };
+
+  /**
+   * @param name a PLY type name (e.g. "uchar" or "uint8").
+   * @return the corresponding type, PLY_UNKNOWN if it is not valid.
+   */
+  static PLYType plyType( const std::string & name );
+
+  /**
+   * Reads a PLY value.
+   * @param reader the reader on the file.
+   * @param type the type of the value.
+   * @param ascii true if the file is an ASCII file.
+   * @param swapBytes true if the file endianness is not the host one.
+   * @return the value.
+   */
+  static double readPLYValue( BufferedStreamReader & reader, PLYType type,
+                              bool ascii, bool swapBytes );
+
+  /**
+   * Reverses the order of the face vertices if \a invert is true.
+   * @param aFace a face.
+   * @param invert true to reverse the order.
+   */
+  static void invertFace( std::vector<unsigned int> & aFace, bool invert );
   
   
   
@@ -141,10 +235,11 @@ public:
 
 
   /**
-   *  'operator<<' for exporting objects of class 'Mesh'.
+   *  'operator<<' for importing objects of class 'Mesh'. The format is
+   *  selected from the filename extension (off, ofs, obj or ply).
    * @param mesh a mesh 
    * @param filename a filename 
-   * @return true if the mesh has been exported correctly.
+   * @return true if the mesh has been imported correctly.
    */
   template <typename TPoint>
   bool
@@ -41,14 +41,63 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <string>
 #include <vector>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/FreemanChain.h" 
+#include "DGtal/io/BufferedStreams.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  /////////////////////////////////////////////////////////////////////////////
+  // struct PointListBinaryFormat
+  /**
+   * Description of struct 'PointListBinaryFormat' <p>
+   * \brief Aim: Describes the binary format of point lists read by
+   * PointListReader::getPointsFromBinaryFile and written by
+   * PointListWriter::exportToBinaryFile.
+   *
+   * The file starts with a header of 32 bytes:
+   * - the 8 characters "DGtalPts";
+   * - a 32-bit byte order mark equal to 0x01020304 (the file is
+   *   written in the endianness of the host);
+   * - the dimension of the points (32-bit);
+   * - the type code of the coordinates (32-bit, see typeCode());
+   * - 4 zero bytes;
+   * - the number of points (64-bit).
+   *
+   * It is followed by the coordinates of the points, point after point.
+   */
+  struct PointListBinaryFormat
+  {
+    /// @return the size of the header in bytes.
+    static std::size_t headerSize() { return 32; }
+
+    /// @return the 8 characters at the beginning of the file.
+    static const char* magic() { return "DGtalPts"; }
+
+    /// @return the byte order mark.
+    static uint32_t byteOrderMark() { return 0x01020304u; }
+
+    /**
+     * @tparam T any arithmetic type.
+     * @return the code of type T: its size in bytes, plus 0x100 for
+     * signed integers and 0x200 for floating-point numbers.
+     */
+    template <typename T>
+    static uint32_t typeCode()
+    {
+      static_assert( std::is_arithmetic<T>::value,
+                     "PointListBinaryFormat: coordinates must be of arithmetic type." );
+      return static_cast<uint32_t>( sizeof( T ) )
+        + ( std::is_floating_point<T>::value ? 0x200u
+            : std::is_signed<T>::value ? 0x100u : 0u );
+    }
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // class PointListReader
   /**
@@ -60,6 +109,13 @@ namespace DGtal
    * each elements is represented in a single line. Blank line or line beginning with
    * "#" are skipped.
    *
+   * The stream is read at once, split into chunks at line boundaries
+   * and, when OpenMP is enabled, the chunks are parsed in parallel
+   * (with a locale-independent number parser for points with
+   * arithmetic coordinates). For very large point clouds, the binary
+   * format described in PointListBinaryFormat is much faster, see
+   * getPointsFromBinaryFile and PointListWriter.
+   *
    *  
    * Simple example:
    * 
@@ -115,6 +171,34 @@ namespace DGtal
     static std::vector< TPoint>  
     getPointsFromFile (const std::string &filename, 
            std::vector<unsigned int>  aVectPosition=std::vector<unsigned int>());
+
+
+    /** 
+     * Imports a vector of points from a stream in the binary format
+     * described in PointListBinaryFormat. When the coordinates are
+     * stored with the type and endianness of the coordinates of
+     * TPoint, the points are loaded with a single read. Otherwise
+     * they are converted.
+     * 
+     * @param in the input stream (opened in binary mode).
+     * @return a vector containing the set of points.
+     * @throw IOException if the stream is not in this format or if
+     * the dimension of the points is not the one of TPoint.
+     **/
+    static std::vector< TPoint>  
+    getPointsFromBinaryInputStream (std::istream &in);
+
+    /** 
+     * Imports a vector of points from a file in the binary format
+     * described in PointListBinaryFormat.
+     * 
+     * @param filename a filename 
+     * @return a vector containing the set of points.
+     * @throw IOException if the file is not in this format or if
+     * the dimension of the points is not the one of TPoint.
+     **/
+    static std::vector< TPoint>  
+    getPointsFromBinaryFile (const std::string &filename);
   
 
 
@@ -162,6 +246,29 @@ namespace DGtal
   
   
 
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /** 
+     * Parses the points of the lines in [begin,end) (which is a
+     * sequence of whole lines).
+     * 
+     * @param begin the first character.
+     * @param end the end of the characters.
+     * @param aVectPosition the position of indices of value points.
+     * @param[out] result the vector where points are appended.
+     **/
+    static void
+    parsePoints (const char* begin, const char* end,
+                 const std::vector<unsigned int> &aVectPosition,
+                 std::vector<TPoint> &result, std::true_type );
+
+    /// Same as above for non-arithmetic coordinates (parsed with std::istream).
+    static void
+    parsePoints (const char* begin, const char* end,
+                 const std::vector<unsigned int> &aVectPosition,
+                 std::vector<TPoint> &result, std::false_type );
+
   }; // end of class PointListReader
 
 
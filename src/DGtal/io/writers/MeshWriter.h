@@ -45,6 +45,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/BufferedStreams.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -54,7 +55,13 @@ namespace DGtal
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF, OBJ and PLY).
+   *
+   * Text is formatted with a BufferedStreamWriter, which produces
+   * the same characters as std::ostream formatting (with the
+   * precision of the given stream) but much faster and independently
+   * of the global locale. PLY files may be written in binary, which
+   * is both faster to write and to read, and lossless.
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
@@ -119,6 +126,23 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh);
+
+    /** 
+     * Export a Mesh towards a PLY format (Stanford polygon format).
+     * Vertex coordinates are exported as doubles and face colors as
+     * unsigned chars (if they are stored in the Mesh object).
+     * 
+     * @param out the output stream of the exported PLY object (it
+     * should be opened in binary mode for a binary export).
+     * @param aMesh the Mesh object to be exported.
+     * @param binary true to export a binary PLY (in the endianness of
+     * the host, default true), false to export an ASCII PLY.
+     * @param exportColor true to try to export the face colors if they are stored in the Mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh,
+                           bool binary=true, bool exportColor=true);
     
     
   };
@@ -130,7 +154,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply). PLY files are binary.
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
@@ -0,0 +1,138 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointListWriter.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PointListWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointListWriter_RECURSES)
+#error Recursive header files inclusion detected in PointListWriter.h
+#else // defined(PointListWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointListWriter_RECURSES
+
+#if !defined PointListWriter_h
+/** Prevents repeated inclusion of headers. */
+#define PointListWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/BufferedStreams.h"
+#include "DGtal/io/readers/PointListReader.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template struct PointListWriter
+  /**
+   * Description of template struct 'PointListWriter' <p>
+   * \brief Aim: Export a vector of points, either as text (one point
+   * per line, as read by PointListReader::getPointsFromFile) or in the
+   * binary format described in PointListBinaryFormat (as read by
+   * PointListReader::getPointsFromBinaryFile).
+   *
+   * @code
+   * std::vector<Z3i::RealPoint> points = ...;
+   * PointListWriter<Z3i::RealPoint>::exportToBinaryFile( "points.bin", points );
+   * std::vector<Z3i::RealPoint> readPoints
+   *   = PointListReader<Z3i::RealPoint>::getPointsFromBinaryFile( "points.bin" );
+   * @endcode
+   *
+   * @tparam TPoint the type of points (with coordinates of arithmetic type).
+   * @see PointListReader
+   */
+  template <typename TPoint>
+  struct PointListWriter
+  {
+    // ----------------------- Standard services ------------------------------
+
+    /**
+     * Exports the points as text, one point per line.
+     *
+     * @param out the output stream (the precision of the stream is used).
+     * @param points the points.
+     * @param separator the separator of the coordinates.
+     * @return true if no errors occur.
+     */
+    static bool exportToStream( std::ostream & out,
+                                const std::vector<TPoint> & points,
+                                char separator = ' ' );
+
+    /**
+     * Exports the points as a text file, one point per line.
+     *
+     * @param filename the filename.
+     * @param points the points.
+     * @param separator the separator of the coordinates.
+     * @return true if no errors occur.
+     */
+    static bool exportToFile( const std::string & filename,
+                              const std::vector<TPoint> & points,
+                              char separator = ' ' );
+
+    /**
+     * Exports the points in the binary format described in
+     * PointListBinaryFormat. Points whose coordinates are stored
+     * contiguously are written with a single write.
+     *
+     * @param out the output stream (opened in binary mode).
+     * @param points the points.
+     * @return true if no errors occur.
+     */
+    static bool exportToBinaryStream( std::ostream & out,
+                                      const std::vector<TPoint> & points );
+
+    /**
+     * Exports the points as a binary file in the format described in
+     * PointListBinaryFormat.
+     *
+     * @param filename the filename.
+     * @param points the points.
+     * @return true if no errors occur.
+     */
+    static bool exportToBinaryFile( const std::string & filename,
+                                    const std::vector<TPoint> & points );
+
+  }; // end of struct PointListWriter
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/PointListWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointListWriter_h
+
+#undef PointListWriter_RECURSES
+#endif // else defined(PointListWriter_RECURSES)
@@ -77,7 +77,7 @@ namespace DGtal
     using Self  = HyperRectDomain_ReverseIterator<Iterator>;
     using Point = typename Iterator::Point;
     using Dimension = typename Point::Dimension;
-    using DifferenceType = typename std::iterator_traits<Self>::difference_type; ///< Type of the difference between two iterators (usually std::ptrdiff_t except for BigInteger).
+    using DifferenceType = typename std::iterator_traits<Self>::difference_type; ///< Type of the difference between two iterators (std::ptrdiff_t except for non-fundamental integers like BigInteger).
 
   public:
     /// @brief Constructor from a HyperRectDomain iterator
@@ -145,18 +145,14 @@ namespace DGtal
         TPoint const,
         std::random_access_iterator_tag,
         TPoint const&,
-#ifdef WITH_BIGINTEGER
-        typename std::conditional<std::is_same<typename TPoint::Component, BigInteger>::value, BigInteger, std::ptrdiff_t>::type
-#else
-        std::ptrdiff_t
-#endif
+        typename std::conditional<std::is_arithmetic<typename TPoint::Component>::value, std::ptrdiff_t, typename TPoint::Component>::type
       >
   {
   public:
     using Point = TPoint;
     using Self  = HyperRectDomain_Iterator<TPoint>;
     using Dimension = typename Point::Dimension;
-    using DifferenceType = typename std::iterator_traits<Self>::difference_type; ///< Type of the difference between two iterators (usually std::ptrdiff_t except for BigInteger).
+    using DifferenceType = typename std::iterator_traits<Self>::difference_type; ///< Type of the difference between two iterators (std::ptrdiff_t except for non-fundamental integers like BigInteger).
 
 
     /** @brief HyperRectDomain iterator constructor
@@ -319,18 +315,14 @@ namespace DGtal
         const TPoint,
         std::random_access_iterator_tag,
         TPoint const&,
-#ifdef WITH_BIGINTEGER
-        typename std::conditional<std::is_same<typename TPoint::Component, BigInteger>::value, BigInteger, std::ptrdiff_t>::type
-#else
-        std::ptrdiff_t
-#endif
+        typename std::conditional<std::is_arithmetic<typename TPoint::Component>::value, std::ptrdiff_t, typename TPoint::Component>::type
       >
   {
   public:
     using Point = TPoint;
     using Self  = HyperRectDomain_subIterator<TPoint>;
     using Dimension = typename Point::Dimension;
-    using DifferenceType = typename std::iterator_traits<Self>::difference_type; ///< Type of the difference between two iterators (usually std::ptrdiff_t except for BigInteger).
+    using DifferenceType = typename std::iterator_traits<Self>::difference_type; ///< Type of the difference between two iterators (std::ptrdiff_t except for non-fundamental integers like BigInteger).
 
     HyperRectDomain_subIterator(const TPoint & p, const TPoint& lower,
         const TPoint &upper,
@@ -46,6 +46,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
@@ -66,6 +67,14 @@ namespace DGtal
    
     It thus describes a modifiable set of points within the given
     domain [Domain].
+
+    The points are kept sorted with respect to PointLess, which is the
+    order of the linearized index of the points in a HyperRectDomain
+    (i.e. the order of its iteration). Membership tests are thus
+    binary searches, ranges of points are inserted by sorting and
+    merging, and union, intersection and difference of two sets are
+    linear merges. Inserting points in the domain order (e.g. when
+    scanning an image) amounts to appending them.
    
     @tparam TDomain a realization of the concept CDomain.
     @see CDigitalSet,CDomain
@@ -89,6 +98,21 @@ namespace DGtal
     typedef typename std::vector<Point>::const_iterator ConstIterator;
     typedef typename std::vector<Point>::iterator MutableIterator;
 
+    /**
+     * The order of the points in the set: points are compared from
+     * their last coordinate to their first one, which is the order of
+     * the linearized index of the points in a HyperRectDomain.
+     */
+    struct PointLess
+    {
+      /**
+       * @param p1 any point.
+       * @param p2 any point.
+       * @return 'true' iff p1 is before p2.
+       */
+      bool operator()( const Point & p1, const Point & p2 ) const;
+    };
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -151,7 +175,9 @@ namespace DGtal
 
     /**
      * Adds the collection of points specified by the two iterators to
-     * this set.
+     * this set. The points are sorted then merged with the points of
+     * the set, in O(m log m + n) for m points added to a set of n
+     * points.
      *
      * @param first the start point in the collection of Point.
      * @param last the last point in the collection of Point.
@@ -260,6 +286,20 @@ namespace DGtal
     DigitalSetBySTLVector<Domain> & operator+=
     ( const DigitalSetBySTLVector<Domain> & aSet );
 
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLVector<Domain> & operator*=
+    ( const DigitalSetBySTLVector<Domain> & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLVector<Domain> & operator-=
+    ( const DigitalSetBySTLVector<Domain> & aSet );
+
     // ----------------------- Model of concepts::CPointPredicate -----------------------------
   public:
 
@@ -323,7 +363,8 @@ namespace DGtal
     CowPtr<Domain> myDomain;
 
     /**
-     * The container storing the points of the set.
+     * The container storing the points of the set, sorted with
+     * respect to PointLess.
      */
     std::vector<Point> myVector;
 
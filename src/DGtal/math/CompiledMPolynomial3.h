@@ -0,0 +1,247 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial3.h
+ * @brief Evaluates a trivariate polynomial and its gradient from a
+ * flat table of coefficients, with the Horner scheme.
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module CompiledMPolynomial3.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial3_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial3.h
+#else // defined(CompiledMPolynomial3_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial3_RECURSES
+
+#if !defined CompiledMPolynomial3_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial3_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial3
+  /**
+   * Description of template class 'CompiledMPolynomial3' <p>
+   * \brief Aim: A "compiled" form of a polynomial in three variables
+   * (an MPolynomial<3,TRing>), which evaluates it (and its gradient)
+   * much faster than the nested MPolynomialEvaluator objects.
+   *
+   * The nonzero part of the polynomial is stored as one flat array
+   * of coefficients, sorted by degree in X, then in Y, then in Z,
+   * with two arrays of offsets. The value is computed with a nested
+   * Horner scheme, and the gradient is computed along the value
+   * within the same loops (each Horner step \f$ v = v x + c \f$ also
+   * gives \f$ v' = v' x + v \f$), so that it costs no extra pass on
+   * the coefficients.
+   *
+   * Several points can be evaluated at once with the batch methods,
+   * which work on groups of \ref LANES points stored as separate
+   * coordinate arrays: the innermost loops of the Horner scheme run
+   * over the points of a group, which lets the compiler vectorize
+   * them. Each point is computed with the same operations as with
+   * operator(), so that both give the same values.
+   *
+   * @code
+   * MPolynomial<3,double> P = ...;
+   * CompiledMPolynomial3<double> C( P );
+   * double fx, fy, fz;
+   * double v = C.valueAndGradient( 1.0, 2.0, 3.0, fx, fy, fz );
+   * @endcode
+   *
+   * @tparam TRing the type of the coefficients and of the variables,
+   * e.g. double.
+   */
+  template <typename TRing>
+  class CompiledMPolynomial3
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TRing Ring;
+    typedef std::size_t Size;
+    /// The number of points evaluated together by the batch methods.
+    static const unsigned int LANES = 8;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~CompiledMPolynomial3();
+
+    /**
+     * Constructor. The object represents the zero polynomial.
+     */
+    CompiledMPolynomial3();
+
+    /**
+     * Constructor from a polynomial.
+     * @param P any polynomial in three variables.
+     */
+    template <typename TAlloc>
+    CompiledMPolynomial3( const MPolynomial<3, Ring, TAlloc> & P );
+
+    /**
+     * Compiles the given polynomial.
+     * @param P any polynomial in three variables.
+     */
+    template <typename TAlloc>
+    void init( const MPolynomial<3, Ring, TAlloc> & P );
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+     * @param x the value of the first variable.
+     * @param y the value of the second variable.
+     * @param z the value of the third variable.
+     * @return the value of the polynomial at (x,y,z).
+     */
+    Ring operator()( Ring x, Ring y, Ring z ) const;
+
+    /**
+     * @param x the value of the first variable.
+     * @param y the value of the second variable.
+     * @param z the value of the third variable.
+     * @param[out] fx the derivative of the polynomial along X at (x,y,z).
+     * @param[out] fy the derivative of the polynomial along Y at (x,y,z).
+     * @param[out] fz the derivative of the polynomial along Z at (x,y,z).
+     * @return the value of the polynomial at (x,y,z).
+     */
+    Ring valueAndGradient( Ring x, Ring y, Ring z,
+                           Ring & fx, Ring & fy, Ring & fz ) const;
+
+    /**
+     * Evaluates the polynomial at \a n points.
+     *
+     * @param n the number of points.
+     * @param x the array of the first coordinates of the points.
+     * @param y the array of the second coordinates of the points.
+     * @param z the array of the third coordinates of the points.
+     * @param[out] values an array of (at least) \a n values, where the
+     * value at the i-th point is written.
+     */
+    void evaluate( Size n, const Ring* x, const Ring* y, const Ring* z,
+                   Ring* values ) const;
+
+    /**
+     * Evaluates the polynomial and its gradient at \a n points.
+     *
+     * @param n the number of points.
+     * @param x the array of the first coordinates of the points.
+     * @param y the array of the second coordinates of the points.
+     * @param z the array of the third coordinates of the points.
+     * @param[out] values an array of (at least) \a n values.
+     * @param[out] fx an array of (at least) \a n derivatives along X.
+     * @param[out] fy an array of (at least) \a n derivatives along Y.
+     * @param[out] fz an array of (at least) \a n derivatives along Z.
+     */
+    void evaluate( Size n, const Ring* x, const Ring* y, const Ring* z,
+                   Ring* values, Ring* fx, Ring* fy, Ring* fz ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the number of coefficients stored in the table.
+    Size nbCoefficients() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The polynomials in Y multiplying X^i are the ones of indices
+    /// myXBlocks[ i ] (for Y^0) to myXBlocks[ i+1 ] (excluded).
+    std::vector<unsigned int> myXBlocks;
+    /// The coefficients of the t-th polynomial in Z are the ones of
+    /// indices myZOffsets[ t ] (for Z^0) to myZOffsets[ t+1 ] (excluded).
+    std::vector<unsigned int> myZOffsets;
+    /// The coefficients.
+    std::vector<Ring> myCoefs;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Evaluates the polynomial, and its gradient if \a G is true, at
+     * \a L points. The output pointers fx, fy, fz are not used when
+     * \a G is false.
+     */
+    template <unsigned int L, bool G>
+    void kernel( const Ring* x, const Ring* y, const Ring* z,
+                 Ring* v, Ring* fx, Ring* fy, Ring* fz ) const;
+
+    /// Evaluates \a n points by groups of LANES points.
+    template <bool G>
+    void batch( Size n, const Ring* x, const Ring* y, const Ring* z,
+                Ring* v, Ring* fx, Ring* fy, Ring* fz ) const;
+
+  }; // end of class CompiledMPolynomial3
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial3'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial3' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRing>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial3<TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial3.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial3_h
+
+#undef CompiledMPolynomial3_RECURSES
+#endif // else defined(CompiledMPolynomial3_RECURSES)
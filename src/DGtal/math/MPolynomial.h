@@ -47,6 +47,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -1995,6 +1996,109 @@ public:
      return res;
    }
    
+  /**
+     Description of template class 'MPolynomialIntervalComputer' <p>
+     \brief Aim: Computes bounds of the values of a polynomial on an
+     axis-aligned box with interval arithmetic.
+
+     The polynomial is bounded as the sum of its coefficients times
+     the exact interval of each power of the first variable, the
+     coefficients being bounded recursively on the remaining
+     variables.
+
+     @tparam n the number of variables or indeterminates.
+     @tparam Ring the type for the coefficent ring of the polynomial.
+     @tparam Alloc the type of allocator.
+  */
+  template <int n, typename Ring, typename Alloc>
+  class MPolynomialIntervalComputer
+  {
+  public:
+    /**
+       @param p any polynomial.
+       @param lo the lower bounds of the variables X_0, ..., X_{n-1}.
+       @param up the upper bounds of the variables X_0, ..., X_{n-1}.
+       @param[out] vmin a lower bound of \a p on the box [lo,up].
+       @param[out] vmax an upper bound of \a p on the box [lo,up].
+       @param[out] magnitude an upper bound of the sum of the
+       absolute values of the monomials of \a p on the box, which
+       bounds the rounding errors of any evaluation of \a p.
+    */
+    static void computeBounds( const MPolynomial<n, Ring, Alloc> & p,
+                               const Ring* lo, const Ring* up,
+                               Ring & vmin, Ring & vmax, Ring & magnitude )
+    {
+      vmin = vmax = magnitude = (Ring) 0;
+      const Ring a = lo[ 0 ];
+      const Ring b = up[ 0 ];
+      const Ring m = std::max( a < (Ring) 0 ? -a : a, b < (Ring) 0 ? -b : b );
+      Ring pa = (Ring) 1, pb = (Ring) 1, pm = (Ring) 1;
+      for ( int i = 0; i <= p.degree(); ++i )
+        {
+          // [xmin,xmax] is the exact interval of X_0^i on [a,b].
+          Ring xmin = std::min( pa, pb );
+          Ring xmax = std::max( pa, pb );
+          if ( ( i % 2 == 0 ) && ( a < (Ring) 0 ) && ( b > (Ring) 0 ) )
+            xmin = (Ring) 0;
+          Ring cmin, cmax, cmag;
+          MPolynomialIntervalComputer<n-1, Ring, Alloc>
+            ::computeBounds( p[ i ], lo + 1, up + 1, cmin, cmax, cmag );
+          const Ring v1 = cmin * xmin, v2 = cmin * xmax;
+          const Ring v3 = cmax * xmin, v4 = cmax * xmax;
+          vmin      += std::min( std::min( v1, v2 ), std::min( v3, v4 ) );
+          vmax      += std::max( std::max( v1, v2 ), std::max( v3, v4 ) );
+          magnitude += cmag * pm;
+          pa *= a; pb *= b; pm *= m;
+        }
+    }
+  };
+
+  /**
+     Specialization of MPolynomialIntervalComputer for constants.
+
+     @tparam Ring the type for the coefficent ring of the polynomial.
+     @tparam Alloc the type of allocator.
+  */
+  template <typename Ring, typename Alloc>
+  class MPolynomialIntervalComputer<0, Ring, Alloc>
+  {
+  public:
+    static void computeBounds( const MPolynomial<0, Ring, Alloc> & p,
+                               const Ring* /*lo*/, const Ring* /*up*/,
+                               Ring & vmin, Ring & vmax, Ring & magnitude )
+    {
+      vmin = vmax = p();
+      magnitude = vmin < (Ring) 0 ? -vmin : vmin;
+    }
+  };
+
+  /**
+     Computes bounds of the values of \a p on the box [lo,up] with
+     interval arithmetic (see MPolynomialIntervalComputer).
+
+     @param p an arbitrary polynomial.
+     @param lo the lower bounds of the variables X_0, ..., X_{n-1}.
+     @param up the upper bounds of the variables X_0, ..., X_{n-1}.
+     @param[out] vmin a lower bound of \a p on the box.
+     @param[out] vmax an upper bound of \a p on the box.
+     @param[out] magnitude an upper bound of the sum of the absolute
+     values of the monomials of \a p on the box.
+
+     @tparam n the number of variables or indeterminates.
+     @tparam Ring the type chosen for the polynomial.
+     @tparam Alloc the type of allocator.
+  */
+  template <int n, typename Ring, typename Alloc>
+  inline
+  void
+  intervalBounds( const MPolynomial<n, Ring, Alloc> & p,
+                  const Ring* lo, const Ring* up,
+                  Ring & vmin, Ring & vmax, Ring & magnitude )
+  {
+    MPolynomialIntervalComputer<n, Ring, Alloc>
+      ::computeBounds( p, lo, up, vmin, vmax, magnitude );
+  }
+
    /**
       Computes q and r such that f = q g + r and degree(r) < degree(g).
    */
@@ -48,6 +48,7 @@
 #include "DGtal/shapes/TriangulatedSurface.h"
 #include "DGtal/shapes/PolygonalSurface.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/BufferedStreams.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -282,6 +283,22 @@ namespace DGtal
         const Color&                   specular_color = Color::White );
 
     
+    /// Exports a triangulated or polygonal surface as a PLY file
+    /// (with topology) into the given output stream. Vertex
+    /// positions are written as doubles, hence a binary export is
+    /// lossless.
+    ///
+    /// @tparam TTriangulatedOrPolygonalSurface either some TriangulatedSurface or some PolygonalSurface.
+    /// @param[in,out] output an output stream (opened in binary mode for a binary export).
+    /// @param[in]     polysurf the input triangulated or polygonal surface mesh.
+    /// @param[in]     binary when 'true' (default), writes a binary PLY in the endianness of the host, otherwise an ASCII PLY.
+    template <typename TTriangulatedOrPolygonalSurface>
+      static
+      bool exportPLY
+      ( std::ostream& output,
+        const TTriangulatedOrPolygonalSurface& polysurf,
+        bool binary = true );
+
     /// Exports a new material in a MTL stream.
     ///
     /// @param[in,out] output_mtl an output stream into a MTL file
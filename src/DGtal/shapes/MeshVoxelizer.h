@@ -32,6 +32,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <vector>
+#include <utility>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/shapes/Mesh.h"
@@ -100,6 +102,7 @@ namespace DGtal
     using VectorR3 = typename Space::RealPoint;
     using PointR2  = typename Space2D::RealPoint;
     using PointZ3  = typename Space::Point;
+    using Integer  = typename Space::Integer;
     using OrientationFunctor = InHalfPlaneBySimple3x3Matrix<PointR2, double>;
     using IntersectionTarget = typename IntersectionTargetTrait<Space, Separation, 1>::Type;
     /*********************************************/
@@ -133,6 +136,69 @@ namespace DGtal
                   const Mesh<MeshPoint> &aMesh,
                   const double scaleFactor = 1.0);
 
+    /**
+     * Voxelize the mesh directly into a dense image: @a value is
+     * written at each voxel of the digitization that lies in the
+     * domain of the image, other voxels are left untouched. Faces are
+     * handled as in voxelize(DigitalSet&, const Mesh<MeshPoint>&, const double).
+     *
+     * The domain is cut into slabs along the z-axis and each face is
+     * binned into the slabs crossed by its bounding box, so that each
+     * slab is voxelized by a single thread without any lock. Even
+     * slabs are processed before odd slabs: two threads never write
+     * into neighboring slabs at the same time, which makes bit-packed
+     * storages such as ImageContainerBySTLVector<Domain,bool> safe,
+     * since a slab holds at least 64 voxels.
+     *
+     * @param [in,out] image a dense image (e.g. ImageContainerBySTLVector),
+     * i.e. setValue at two distinct points of non neighboring slabs
+     * should not touch the same memory.
+     * @param [in] aMesh the mesh to voxelize (vertex coordinates will
+     * be casted to @e PointR3 points.
+     * @param [in] value the value written at each voxel.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @tparam TImage a model of concepts::CImage on a 3D HyperRectDomain.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename TImage, typename MeshPoint>
+    void voxelizeInImage(TImage &image,
+                         const Mesh<MeshPoint> &aMesh,
+                         const typename TImage::Value &value,
+                         const double scaleFactor = 1.0);
+
+    /**
+     * Solid voxelization of a closed mesh into a dense image: @a value
+     * is written at each voxel of the domain of the image whose
+     * center is inside the mesh (or on its boundary), other voxels are
+     * left untouched. The result does not depend on the Separation
+     * parameter, and surface voxels may be added with voxelizeInImage.
+     *
+     * A ray along the x-axis is cast from each (y,z) of the domain,
+     * and the voxels between its odd and even crossings with the mesh
+     * are filled (parity rule). The rays are slightly shifted so that
+     * they never hit an edge or a vertex of meshes with integer
+     * coordinates. The triangles are bucketed per z-slab as in
+     * voxelizeInImage, and the slabs are processed in parallel in the
+     * same way, so that Shortcuts::BinaryImage is a valid output.
+     *
+     * @param [in,out] image a dense image (e.g. ImageContainerBySTLVector),
+     * i.e. setValue at two distinct points of non neighboring slabs
+     * should not touch the same memory.
+     * @param [in] aMesh a closed (watertight) mesh, whose faces are
+     * triangulated as in voxelize(DigitalSet&, const Mesh<MeshPoint>&, const double).
+     * @param [in] value the value written at each interior voxel.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @tparam TImage a model of concepts::CImage on a 3D HyperRectDomain.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename TImage, typename MeshPoint>
+    void voxelizeSolidInImage(TImage &image,
+                              const Mesh<MeshPoint> &aMesh,
+                              const typename TImage::Value &value,
+                              const double scaleFactor = 1.0);
+
     /**
      * Voxelize a unique triangle (a,b,c) into the digital set.
      * voxels are inserted to the @e outputSet.
@@ -210,6 +276,80 @@ namespace DGtal
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
+    /**
+     * Calls @a f on each voxel of the bounding box @a bbox that belongs
+     * to the voxelization of ABC (possibly several times).
+     * @param f a functor called as f( v ) on each voxel v.
+     * @param A Point A
+     * @param B Point B
+     * @param C Point C
+     * @param n normal of ABC
+     * @param bbox the part of the bounding box of ABC to visit.
+     * @tparam TVoxelFunctor the type of a functor taking a PointZ3.
+     */
+    template <typename TVoxelFunctor>
+    void visitTriangleVoxels(const TVoxelFunctor & f,
+                             const PointR3& A,
+                             const PointR3& B,
+                             const PointR3& C,
+                             const VectorR3& n,
+                             const std::pair<PointZ3, PointZ3>& bbox);
+
+    /**
+     * @param lo the lowest point of a domain.
+     * @param up the uppest point of a domain.
+     * @return the thickness of the z-slabs in which the domain is cut
+     * by the voxelizations into images (each slab holds at least 64
+     * voxels).
+     */
+    static
+    Integer slabThickness(const PointZ3& lo, const PointZ3& up);
+
+    /**
+     * Bins the faces of a mesh into the z-slabs of a domain crossed by
+     * their bounding box: the faces of slab s are
+     * bins[offsets[s]] ... bins[offsets[s+1]-1].
+     * @param [out] offsets the offsets of the slabs in @a bins.
+     * @param [out] bins the indices of the faces of each slab.
+     * @param [in] aMesh any mesh.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * @param [in] lo the lowest point of the domain.
+     * @param [in] up the uppest point of the domain.
+     * @param [in] thickness the thickness of the slabs.
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    static
+    void binFacesInSlabs(std::vector<std::size_t>& offsets,
+                         std::vector<std::size_t>& bins,
+                         const Mesh<MeshPoint> &aMesh,
+                         const double scaleFactor,
+                         const PointZ3& lo,
+                         const PointZ3& up,
+                         const Integer thickness);
+
+    /**
+     * Scales the triangle (a,b,c) and computes its normal and the
+     * bounding box of its voxels.
+     * @param [out] A the scaled point a
+     * @param [out] B the scaled point b
+     * @param [out] C the scaled point c
+     * @param [out] n the normal of ABC
+     * @param [out] bbox the bounding box of ABC
+     * @param [in] a the first point of the triangle
+     * @param [in] b the second point of the triangle
+     * @param [in] c the third point of the triangle
+     * @param [in] scaleFactor the scale factor to apply to the triangle
+     * @tparam MeshPoint the type of point of the triangle.
+     */
+    template<typename MeshPoint>
+    static
+    void triangleGeometry(PointR3& A, PointR3& B, PointR3& C,
+                          VectorR3& n,
+                          std::pair<PointZ3, PointZ3>& bbox,
+                          const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
+                          const double scaleFactor);
+
     // ----------------------- Members ------------------------------
 
   private:
@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OctreeImplicitDigitizer.h
+ * @brief Computes the Gauss digitization of an implicit shape into an
+ * image, by blocks classified with interval bounds.
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module OctreeImplicitDigitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OctreeImplicitDigitizer_RECURSES)
+#error Recursive header files inclusion detected in OctreeImplicitDigitizer.h
+#else // defined(OctreeImplicitDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OctreeImplicitDigitizer_RECURSES
+
+#if !defined OctreeImplicitDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define OctreeImplicitDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OctreeImplicitDigitizer
+  /**
+   * Description of template class 'OctreeImplicitDigitizer' <p>
+   * \brief Aim: Writes the Gauss digitization of an implicit shape
+   * (i.e. the output of a GaussDigitizer) into a binary image,
+   * without evaluating the implicit function at every point.
+   *
+   * The domain of the image is split into blocks, which are
+   * recursively halved (as in an octree). The values of the implicit
+   * function on each block are bounded with the valueBounds method
+   * of the shape: a block where the function is surely negative is
+   * filled with 'true', a block where it is surely positive is filled
+   * with 'false', and only the points of the small blocks near the
+   * boundary are evaluated, all at once with the evaluate method of
+   * the shape. The result is exactly the one of the digitizer, since
+   * bounds are only trusted when they exceed a margin proportional to
+   * the magnitude of the function.
+   *
+   * Columns of blocks, spanning the whole first axis, are processed in
+   * parallel (with OpenMP).
+   *
+   * @code
+   * typedef OctreeImplicitDigitizer< Z3i::Space, ImplicitPolynomial3Shape<Z3i::Space> > Digitizer;
+   * Digitizer octree( dshape );
+   * PackedBinaryImage< Z3i::Domain > image( dshape.getDomain() );
+   * octree.digitize( image );
+   * @endcode
+   *
+   * @tparam TSpace an arbitrary model of CSpace.
+   * @tparam TImplicitShape a model of CEuclideanOrientedShape whose
+   * orientation is given by the sign of its operator(), and which
+   * provides valueBounds( lo, up, vmin, vmax, magnitude ) and
+   * evaluate( n, x, y, z, values ) (giving the same values as its
+   * operator()), e.g. ImplicitPolynomial3Shape.
+   */
+  template <typename TSpace, typename TImplicitShape>
+  class OctreeImplicitDigitizer
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef TImplicitShape ImplicitShape;
+    typedef typename ImplicitShape::Ring Ring;
+    typedef GaussDigitizer<Space, ImplicitShape> Digitizer;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::Dimension Dimension;
+    typedef HyperRectDomain<Space> Domain;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~OctreeImplicitDigitizer();
+
+    /**
+     * Constructor.
+     *
+     * @param digitizer a digitizer, initialized and attached to a shape.
+     * @param leafSize the width of the blocks whose points are all
+     * evaluated when they are not classified.
+     * @param columnSize the width (along the axes other than the
+     * first one) of the columns processed in parallel.
+     */
+    OctreeImplicitDigitizer( ConstAlias<Digitizer> digitizer,
+                             Integer leafSize = 4, Integer columnSize = 32 );
+
+    /**
+     * Sets the value of every point of the domain of the image to the
+     * value of the digitizer at this point.
+     *
+     * @param[in,out] image a binary image (e.g. PackedBinaryImage),
+     * i.e. setValue at two points of different rows (along the first
+     * axis) should not touch the same memory.
+     * @return the number of points that were evaluated.
+     *
+     * @tparam TImage a model of concepts::CImage with boolean values
+     * on a HyperRectDomain.
+     */
+    template <typename TImage>
+    Size digitize( TImage & image ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The digitizer.
+    const Digitizer * myDigitizer;
+    /// The width of the blocks whose points are all evaluated.
+    Integer myLeafSize;
+    /// The width of the columns processed in parallel.
+    Integer myColumnSize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Digitizes the points of the box [lo,up] into the image.
+     * @return the number of points that were evaluated.
+     */
+    template <typename TImage>
+    Size digitizeBox( TImage & image, const Point & lo, const Point & up ) const;
+
+    /// Sets the value of every point of the box [lo,up] of the image.
+    template <typename TImage>
+    static void fillBox( TImage & image, const Point & lo, const Point & up,
+                         bool value );
+
+  }; // end of class OctreeImplicitDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OctreeImplicitDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OctreeImplicitDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TImplicitShape>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OctreeImplicitDigitizer<TSpace, TImplicitShape> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/OctreeImplicitDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OctreeImplicitDigitizer_h
+
+#undef OctreeImplicitDigitizer_RECURSES
+#endif // else defined(OctreeImplicitDigitizer_RECURSES)
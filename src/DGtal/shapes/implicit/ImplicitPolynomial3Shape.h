@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +76,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial3< Ring > CompiledPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -137,6 +139,51 @@ namespace DGtal
     inline
     RealVector gradient( const RealPoint &aPoint ) const;
 
+    /**
+       Computes the value and the gradient of the polynomial at once.
+
+       @param aPoint any point in the Euclidean space.
+       @param[out] grad the gradient vector of the polynomial at \a aPoint.
+       @return the value of the polynomial at \a aPoint.
+    */
+    Ring valueAndGradient( const RealPoint &aPoint, RealVector &grad ) const;
+
+    /**
+       Evaluates the polynomial at \a n points at once, given by the
+       arrays of their coordinates (see CompiledMPolynomial3::evaluate).
+
+       @param n the number of points.
+       @param x the array of the first coordinates of the points.
+       @param y the array of the second coordinates of the points.
+       @param z the array of the third coordinates of the points.
+       @param[out] values an array of (at least) \a n values, equal to
+       the ones given by operator().
+    */
+    void evaluate( std::size_t n, const Ring* x, const Ring* y, const Ring* z,
+                   Ring* values ) const;
+
+    /**
+       Bounds the values of the polynomial on an axis-aligned box with
+       interval arithmetic (see MPolynomialIntervalComputer), both on
+       the polynomial and on its mean value form around the center of
+       the box.
+
+       @param lo the lowest point of the box.
+       @param up the highest point of the box.
+       @param[out] vmin a lower bound of the polynomial on the box.
+       @param[out] vmax an upper bound of the polynomial on the box.
+       @param[out] magnitude an upper bound of the sum of the absolute
+       values of the monomials on the box, such that values computed
+       by operator() are known up to a small multiple of magnitude.
+    */
+    void valueBounds( const RealPoint &lo, const RealPoint &up,
+                      Ring & vmin, Ring & vmax, Ring & magnitude ) const;
+
+    /**
+       @return the polynomial defining the shape.
+    */
+    const Polynomial3 & polynomial() const;
+
 // ------------------------------------------------------------ Added by Anis Benyoub
 
     /**
@@ -221,6 +268,8 @@ namespace DGtal
   private:
     /// The 3-polynomial defining the implicit shape.
     Polynomial3 myPolynomial;
+    /// The compiled form of myPolynomial, used for evaluations.
+    CompiledPolynomial3 myCompiled;
 
     // Partial deriatives
     Polynomial3 myFx;
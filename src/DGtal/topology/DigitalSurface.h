@@ -569,6 +569,44 @@ namespace DGtal
     */
     FaceSet allOpenFaces() const;
 
+    /**
+       Computes the closed and the open faces of the digital surface
+       in one pass over its vertices. Each closed umbrella is kept
+       only when it is reached from its representative state, so that
+       no set of faces is ever built.
+
+       @param[out] closed_faces the closed faces of the digital
+       surface, in the same order as allClosedFaces().
+       @param[out] open_faces the open faces of the digital surface,
+       in the same order as allOpenFaces().
+       @param parallel when 'true' (and OpenMP is available), the
+       vertices are processed in parallel, each thread using its own
+       copy of the surface (i.e. of its tracker).
+
+       @note Callers that need the faces several times should call
+       this method once and keep the two ranges. Like all the
+       umbrella services, it uses the tracker of the surface, hence
+       it must not be called concurrently on the same object.
+    */
+    void computeFaces( FaceRange & closed_faces, FaceRange & open_faces,
+                       bool parallel = true ) const;
+
+    /**
+       The faces are computed by computeFaces at each call.
+
+       @return the range of all closed faces of the digital surface,
+       in the same order as allClosedFaces().
+    */
+    FaceRange allClosedFaceRange() const;
+
+    /**
+       The faces are computed by computeFaces at each call.
+
+       @return the range of all open faces of the digital surface, in
+       the same order as allOpenFaces().
+    */
+    FaceRange allOpenFaceRange() const;
+
     /**
        @param state any valid state (i.e. some pivot cell) on the surface.
        @return the face that contains the given [state].
@@ -697,6 +735,28 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Walks around the umbrella of the given state, like computeFace.
+
+       @param state any valid state on the surface.
+       @param[out] face the face containing [state], when the function
+       returns 'true'.
+       @return 'false' if the face is closed and [state] is not its
+       representative state, 'true' otherwise.
+    */
+    bool computeFaceFromRepresentative( const UmbrellaState & state,
+                                        Face & face ) const;
+
+    /**
+       Appends the closed faces whose representative state lies on
+       vertex [v], and all the open faces around [v].
+       @param v any vertex of the surface.
+       @param[in,out] closed_faces the range where closed faces are added.
+       @param[in,out] open_faces the range where open faces are added.
+    */
+    void appendFacesAroundVertex( const Vertex & v, FaceRange & closed_faces,
+                                  FaceRange & open_faces ) const;
+
   }; // end of class DigitalSurface
 
 
@@ -42,6 +42,10 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -124,6 +128,10 @@ namespace DGtal
     // A map from an arc (a std::pair of VertexIndex's) to its face
     // index.
     typedef std::map< Arc, FaceIndex > Arc2FaceIndex;
+    /// A vector of arcs with an associated index (face or half-edge
+    /// index), sorted by arcs. It replaces maps while building the
+    /// data structure.
+    typedef std::vector< std::pair< Arc, Index > > SortedArcIndices;
     
     /// Represents an unoriented edge as two vertex indices, the first
     /// lower than the second.
@@ -152,6 +160,10 @@ namespace DGtal
         return ( start() < other.start() )
           || ( ( start() == other.start() ) && ( end() < other.end() ) );
       }
+      bool operator==( const Edge& other ) const
+      {
+        return ( start() == other.start() ) && ( end() == other.end() );
+      }
     };
 
     /// Represents an unoriented triangle as three vertices.
@@ -234,27 +246,20 @@ namespace DGtal
     static Size getUnorderedEdgesFromTriangles
     ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out )
     {
-      typedef std::set< Edge > EdgeSet;
-      typedef std::set< VertexIndex > VertexIndexSet;
-      VertexIndexSet vertexSet;
-      EdgeSet edgeSet;
+      VertexIndexRange vertices;
+      vertices.reserve( 3 * triangles.size() );
+      edges_out.clear();
+      edges_out.reserve( 3 * triangles.size() );
       for( const Triangle& T : triangles )
         {
-          edgeSet.insert( Edge( T.i(), T.j() ) );
-          edgeSet.insert( Edge( T.j(), T.k() ) );
-          edgeSet.insert( Edge( T.k(), T.i() ) );
-          vertexSet.insert( T.i() );
-          vertexSet.insert( T.j() );
-          vertexSet.insert( T.k() );
-        }
-      edges_out.resize( edgeSet.size() );
-      Size e = 0;
-      for ( const Edge& edge : edgeSet )
-        {
-          edges_out.at(e) = edge;
-          ++e;
+          edges_out.push_back( Edge( T.i(), T.j() ) );
+          edges_out.push_back( Edge( T.j(), T.k() ) );
+          edges_out.push_back( Edge( T.k(), T.i() ) );
+          vertices.push_back( T.i() );
+          vertices.push_back( T.j() );
+          vertices.push_back( T.k() );
         }
-      return vertexSet.size();
+      return sortUnique( edges_out, vertices );
     }
 
     /** 
@@ -382,6 +387,10 @@ namespace DGtal
     /// @return the euler characteristic of the corresponding combinatorial mesh.
     long Euler() const
     { return (long) nbVertices() - (long) nbEdges() + (long) nbFaces(); }
+
+    /// @return an estimation of the number of bytes allocated by the
+    /// data structure (half-edges, index arrays and arc map).
+    Size heapMemory() const;
     
     /// @param i any valid half-edge index.
     /// @return the half-edge of index \a i.
@@ -1404,6 +1413,77 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// Sorts and removes duplicates of the given edges and vertices.
+    /// @param[in,out] edges a range of edges.
+    /// @param[in,out] vertices a range of vertex indices.
+    /// @return the number of distinct vertices.
+    static
+    Size sortUnique( std::vector< Edge >& edges, VertexIndexRange& vertices )
+    {
+      std::sort( edges.begin(), edges.end() );
+      edges.erase( std::unique( edges.begin(), edges.end() ), edges.end() );
+      std::sort( vertices.begin(), vertices.end() );
+      return std::unique( vertices.begin(), vertices.end() ) - vertices.begin();
+    }
+
+    /// Sorts the arcs associated to faces and checks that no arc
+    /// belongs to two faces.
+    /// @param[in,out] de2fi the arcs of each face.
+    /// @return the smallest face index having an arc that belongs to
+    /// a face of smaller index, or HALF_EDGE_INVALID_INDEX if there is
+    /// none.
+    static
+    FaceIndex sortArcsOfFaces( SortedArcIndices& de2fi )
+    {
+      std::sort( de2fi.begin(), de2fi.end() );
+      FaceIndex dropped = HALF_EDGE_INVALID_INDEX;
+      for ( Size i = 1; i < de2fi.size(); ++i )
+        if ( de2fi[ i - 1 ].first == de2fi[ i ].first )
+          dropped = std::min( dropped, de2fi[ i ].second );
+      return dropped;
+    }
+
+    /// @param arcs any sorted range of arcs with their index.
+    /// @param vi the vertex index of some vertex.
+    /// @param vj the vertex index of some other vertex.
+    /// @return the index associated to arc (vi,vj) or
+    /// HALF_EDGE_INVALID_INDEX if not found.
+    static
+    Index findArcIndex( const SortedArcIndices& arcs,
+                        VertexIndex vi, VertexIndex vj )
+    {
+      const Arc arc( vi, vj );
+      auto it = std::lower_bound( arcs.cbegin(), arcs.cend(), arc,
+                                  [] ( const std::pair< Arc, Index >& a, const Arc& b )
+                                  { return a.first < b; } );
+      return ( it != arcs.cend() && it->first == arc ) ? it->second : HALF_EDGE_INVALID_INDEX;
+    }
+
+    /// Sorts the arcs of the half-edges and fills myArc2Index with
+    /// them in order.
+    /// @param[in,out] arcs the arcs with their half-edge index.
+    void setArc2Index( SortedArcIndices& arcs )
+    {
+      std::sort( arcs.begin(), arcs.end() );
+      myArc2Index.clear();
+      for ( const auto& arc : arcs )
+        myArc2Index.insert( myArc2Index.end(), arc );
+    }
+
+    static
+    FaceIndex arc2FaceIndex( const SortedArcIndices& de2fi,
+                             VertexIndex vi, VertexIndex vj )
+    {
+      ASSERT( !de2fi.empty() );
+      const FaceIndex f = findArcIndex( de2fi, vi, vj );
+      // If no such directed edge exists, then there's no such face in the mesh.
+      // The edge must be a boundary edge.
+      // In this case, the reverse orientation edge must have a face.
+      ASSERT( f != HALF_EDGE_INVALID_INDEX
+              || findArcIndex( de2fi, vj, vi ) != HALF_EDGE_INVALID_INDEX );
+      return f;
+    }
+
     static
     FaceIndex arc2FaceIndex( const Arc2FaceIndex& de2fi,
                              VertexIndex vi, VertexIndex vj )
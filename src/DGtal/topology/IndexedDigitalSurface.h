@@ -116,6 +116,7 @@ namespace DGtal
     typedef std::vector<RealPoint>                   PositionsStorage;
     typedef std::vector<PolygonalFace>               PolygonalFacesStorage;
     typedef std::vector<SCell>                       SCellStorage;
+    typedef std::vector< std::pair< SCell, Index > > SortedSCellIndices;
 
     // Required by CUndirectedSimpleLocalGraph
     typedef VertexIndex                              Vertex;
@@ -245,14 +246,15 @@ namespace DGtal
     /**
      * Constructor.
      */
-    IndexedDigitalSurface() : isHEDSValid( false ), myContainer( 0 ) {}
+    IndexedDigitalSurface()
+      : isHEDSValid( false ), myContainer( 0 ), myBuildPeakMemory( 0 ) {}
 
     /// Constructor from digital surface container.
     /// @param surfContainer any instance of digital surface
     /// container. Pass a CountedPtr or any variant if you wish to
     /// secure its aliasing.
     IndexedDigitalSurface( ConstAlias< DigitalSurfaceContainer > surfContainer )
-      : isHEDSValid( false ), myContainer( 0 )
+      : isHEDSValid( false ), myContainer( 0 ), myBuildPeakMemory( 0 )
     {
       build( surfContainer );
     }
@@ -272,6 +274,26 @@ namespace DGtal
     /// neighborhoods).
     bool build( ConstAlias< DigitalSurfaceContainer > surfContainer );
 
+    /// Builds the half-edge data structure from the given digital
+    /// surface container, like build( surfContainer ), but numbers
+    /// the vertices in the order of the given surfels, e.g. along a
+    /// space-filling curve so that successive vertices are close.
+    ///
+    /// @param surfContainer any instance of digital surface
+    /// container. Pass a CountedPtr or any variant if you wish to
+    /// secure its aliasing.
+    ///
+    /// @param vertexSurfels the surfels of the container, each one
+    /// once, in the order of their vertex indices. If empty, the
+    /// vertices are numbered in the order of the container.
+    ///
+    /// @return true if everything went allright, false if it was not
+    /// possible to build a consistent data structure (e.g., butterfly
+    /// neighborhoods) or if \a vertexSurfels are not the surfels of
+    /// the container.
+    bool build( ConstAlias< DigitalSurfaceContainer > surfContainer,
+                const SCellStorage& vertexSurfels );
+
     /**
        @return a const reference to the stored container.
     */
@@ -286,6 +308,17 @@ namespace DGtal
     const HalfEdgeDataStructure& heds() const
     { return myHEDS; }
 
+    /// @return an estimation of the heap memory (in bytes) used by
+    /// this object, excluding the digital surface container.
+    Size heapMemory() const;
+
+    /// @return an estimation of the peak heap memory (in bytes) used
+    /// by the last call to build, i.e. the memory of this object plus
+    /// its temporary arrays. The copy of the container made by the
+    /// DigitalSurface used for enumerating faces is not included.
+    Size buildPeakMemory() const
+    { return myBuildPeakMemory; }
+
     // ------------------------- standard services ------------------------------
   public:
     /// @return the number of half edges in the structure.
@@ -688,6 +721,8 @@ namespace DGtal
     SCellStorage          myArc2Linel;
     /// Mapping FaceIndex   -> Pointel
     SCellStorage          myFaceIndex2Pointel;
+    /// Estimated peak heap memory used by the last build.
+    Size                  myBuildPeakMemory;
 
     
     // ------------------------- Private Datas --------------------------------
@@ -696,6 +731,21 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// @param cells a range of pairs (cell,index) sorted by cells.
+    /// @param c any cell of \a cells.
+    /// @return the index associated to \a c.
+    static Index sortedSCellIndex( const SortedSCellIndices& cells,
+                                   const SCell& c );
+
+    /// Fills the (empty) map \a m with the pairs of \a cells. Since
+    /// they are sorted, each insertion takes constant time.
+    ///
+    /// @param[out] m an empty map cell -> index.
+    /// @param cells a range of pairs (cell,index) sorted by cells.
+    template <typename TIndex>
+    static void fillMap( std::map< SCell, TIndex >& m,
+                         const SortedSCellIndices& cells );
+
   private:
 
     // ------------------------- Internals ------------------------------------
@@ -48,6 +48,7 @@
 #include "DGtal/topology/Topology.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/SurfelBitSet.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -68,6 +69,9 @@ namespace DGtal
      It is also a model of CUndirectedSimpleLocalGraph, so as to be able
      to visit itself with a BreadthFirstVisitor. The "Light" or
      lazyness is implemented this way.
+     The visited surfels are marked in a SurfelBitSet, which is a bitmap
+     over the space when the space is small enough, and a std::set
+     of surfels otherwise.
 
      @tparam TKSpace a model of CCellularGridSpaceND: the type chosen
      for the cellular grid space.
@@ -230,7 +234,9 @@ namespace DGtal
     };
 
     // -------------------- specific types ------------------------------
-    typedef BreadthFirstVisitor< Self > SelfVisitor;
+    /// The set used to mark the visited surfels in a traversal.
+    typedef SurfelBitSet<KSpace> SurfelMarkSet;
+    typedef BreadthFirstVisitor< Self, SurfelMarkSet > SelfVisitor;
     typedef GraphVisitorRange< SelfVisitor > SelfVisitorRange;
     typedef typename SelfVisitorRange::ConstIterator SurfelConstIterator;
     typedef typename KSpace::Space Space;
@@ -301,6 +307,22 @@ namespace DGtal
     /// surfels.
     Size nbSurfels() const;
 
+    /**
+       Visits all the surfels of this digital surface with a
+       breadth-first traversal whose layers are processed in parallel
+       when OpenMP is available, each thread with its own tracker. The
+       visited surfels are marked with SurfelBitSet::insertConcurrently,
+       once all the pages of \a visited are allocated.
+
+       @param[out] visited the set of all the surfels of the surface.
+       @param f a functor called once on each surfel, concurrently
+       from several threads and in no particular order.
+
+       @note the surfel predicate must be callable concurrently.
+    */
+    template <typename SurfelFunctor>
+    void traverseConcurrently( SurfelMarkSet & visited, SurfelFunctor f ) const;
+
     /// @return 'true' is the surface has no surfels, 'false'
     /// otherwise. NB: O(1) operation.
     bool empty() const;
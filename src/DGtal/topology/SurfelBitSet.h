@@ -0,0 +1,356 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelBitSet.h
+ * @brief A set of surfels stored as a bitmap over the cells of a
+ * small bounded cellular grid space, or as a std::set otherwise.
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module SurfelBitSet.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelBitSet_RECURSES)
+#error Recursive header files inclusion detected in SurfelBitSet.h
+#else // defined(SurfelBitSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelBitSet_RECURSES
+
+#if !defined SurfelBitSet_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelBitSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelBitSet
+  /**
+   * Description of template class 'SurfelBitSet' <p>
+   * \brief Aim: A set of surfels (signed cells of dimension n-1) of a
+   * bounded cellular grid space, stored as one bit per surfel. It is
+   * a drop-in replacement of `KSpace::SCellSet` (a std::set) for
+   * marking the visited surfels of a traversal (see e.g.
+   * BreadthFirstVisitor), where it avoids any allocation per surfel
+   * and any comparison of cells.
+   *
+   * Each surfel is identified by the spel (voxel) which lies just
+   * above it along its orthogonal direction, by this direction and
+   * by its sign, hence there are 2n bits per spel. Spels range from
+   * the lower bound of the space to one past its upper bound, so
+   * that surfels on the upper border are represented too.
+   *
+   * Bits are stored by pages, which are allocated only when a surfel
+   * is inserted in them. Hence the set uses a memory proportional to
+   * the part of the space where it has elements, plus a directory of
+   * one (empty) vector per page. Since this directory grows with the
+   * volume of the space, the bitmap is only used when the space has
+   * at most MAX_BITS bits. Otherwise, and when the set is default
+   * constructed, the surfels are stored in a `KSpace::SCellSet`, so
+   * that a small surface in a huge space costs as much as before.
+   *
+   * Several threads may insert surfels at the same time with
+   * insertConcurrently(), once all pages are allocated with
+   * allocatePages(). The other methods are not thread-safe.
+   *
+   * @tparam TKSpace any model of CCellularGridSpaceND, e.g. KhalimskySpaceND.
+   *
+   * @see LightImplicitDigitalSurface, LightExplicitDigitalSurface
+   */
+  template <typename TKSpace>
+  class SurfelBitSet
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef SurfelBitSet<TKSpace>   Self;
+    typedef TKSpace                 KSpace;
+    typedef typename KSpace::SCell  SCell;
+    typedef typename KSpace::Point  Point;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::SCellSet SCellSet;
+    typedef SCell                   key_type;
+    typedef SCell                   value_type;
+    typedef std::size_t             size_type;
+    typedef DGtal::uint64_t         Word;
+    static const Dimension dimension = KSpace::dimension;
+
+    /// Read-only forward iterator on the surfels of the set, in the
+    /// order of their bits.
+    class const_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef SCell                     value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const SCell*              pointer;
+      typedef const SCell&              reference;
+
+      const_iterator() : mySet( 0 ), myBit( 0 ) {}
+      /// Iterator on a bit of a bitmap set.
+      const_iterator( const Self* set, size_type bit )
+        : mySet( set ), myBit( bit )
+      {
+        if ( mySet != 0 && myBit < mySet->myNbBits ) myCell = mySet->cell( myBit );
+      }
+      /// Iterator on a surfel of a set which is not a bitmap.
+      const_iterator( const Self* set, typename SCellSet::const_iterator it )
+        : mySet( set ), myBit( 0 ), myIt( it )
+      {
+        if ( myIt != mySet->mySurfels.end() ) myCell = *myIt;
+      }
+      reference operator*() const { return myCell; }
+      pointer operator->() const { return &myCell; }
+      const_iterator& operator++()
+      {
+        if ( mySet->isBitmap() )
+          {
+            myBit = mySet->nextBit( myBit + 1 );
+            if ( myBit < mySet->myNbBits ) myCell = mySet->cell( myBit );
+          }
+        else if ( ++myIt != mySet->mySurfels.end() ) myCell = *myIt;
+        return *this;
+      }
+      const_iterator operator++( int )
+      {
+        const_iterator tmp( *this );
+        ++*this;
+        return tmp;
+      }
+      bool operator==( const const_iterator& other ) const
+      {
+        return ( myBit == other.myBit )
+          && ( mySet == 0 || mySet->isBitmap() || myIt == other.myIt );
+      }
+      bool operator!=( const const_iterator& other ) const
+      { return ! ( *this == other ); }
+      /// @return the index of the bit of the current surfel (bitmap only).
+      size_type bit() const { return myBit; }
+
+    private:
+      const Self* mySet;
+      size_type   myBit;
+      typename SCellSet::const_iterator myIt;
+      SCell       myCell;
+    };
+    typedef const_iterator iterator;
+
+    /// The number of words of a page.
+    static const size_type PAGE_WORDS = 64;
+    /// The maximal number of bits of a bitmap (a directory of 2^16
+    /// pages), above which surfels are stored in a std::set.
+    static const size_type MAX_BITS = size_type( 1 ) << 28;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~SurfelBitSet();
+
+    /**
+     * Constructor. The set is empty and is not a bitmap until init()
+     * is called.
+     */
+    SurfelBitSet();
+
+    /**
+     * Constructor. The set is empty.
+     * @param K any bounded cellular grid space.
+     */
+    SurfelBitSet( const KSpace & K );
+
+    /**
+     * Empties the set and prepares it for the surfels of \a K: the set
+     * is a bitmap if \a K has at most MAX_BITS bits.
+     * @param K any bounded cellular grid space.
+     */
+    void init( const KSpace & K );
+
+    /// @return 'true' if the surfels are stored in a bitmap, 'false'
+    /// if they are stored in a std::set.
+    bool isBitmap() const;
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /// @return the number of surfels in the set.
+    size_type size() const;
+
+    /// @return 'true' if the set has no surfel.
+    bool empty() const;
+
+    /**
+     * @param s any surfel of the space.
+     * @return 1 if \a s is in the set, 0 otherwise.
+     */
+    size_type count( const SCell & s ) const;
+
+    /**
+     * @param s any surfel of the space.
+     * @return an iterator on \a s if it is in the set, end() otherwise.
+     */
+    const_iterator find( const SCell & s ) const;
+
+    /**
+     * Inserts a surfel.
+     * @param s any surfel of the space.
+     * @return an iterator on \a s and 'true' if \a s was not in the set.
+     */
+    std::pair<const_iterator, bool> insert( const SCell & s );
+
+    /**
+     * Removes a surfel.
+     * @param s any surfel of the space.
+     * @return 1 if \a s was in the set, 0 otherwise.
+     */
+    size_type erase( const SCell & s );
+
+    /**
+     * Removes a surfel.
+     * @param it a valid iterator on a surfel of the set.
+     */
+    void erase( const_iterator it );
+
+    /// Empties the set (allocated pages are kept).
+    void clear();
+
+    /// @return an iterator on the first surfel of the set.
+    const_iterator begin() const;
+
+    /// @return an iterator after the last surfel of the set.
+    const_iterator end() const;
+
+    /**
+     * Swaps the content of this set with \a other.
+     * @param other any other set.
+     */
+    void swap( SurfelBitSet & other );
+
+    // ----------------------- Concurrent services ----------------------------
+  public:
+
+    /// Allocates all the pages of the set, which is required before
+    /// calling insertConcurrently().
+    void allocatePages();
+
+    /**
+     * Inserts a surfel, possibly at the same time as other threads
+     * insert other surfels: exactly one of the threads inserting a
+     * given surfel gets 'true'. All pages must have been allocated
+     * with allocatePages() before. The size of the set is not
+     * updated, call updateSize() after the concurrent insertions.
+     *
+     * When the set is not a bitmap, insertions are serialized.
+     *
+     * @param s any surfel of the space.
+     * @return 'true' if \a s was not in the set.
+     */
+    bool insertConcurrently( const SCell & s );
+
+    /// Recomputes the number of surfels, after insertConcurrently().
+    void updateSize();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The space of the surfels.
+    KSpace myK;
+    /// The lower bound of the spels.
+    Point myLowerBound;
+    /// The number of spels along each axis.
+    Point myExtent;
+    /// The number of bits (0 if the set is not a bitmap).
+    size_type myNbBits;
+    /// The number of surfels of the set.
+    size_type mySize;
+    /// The pages of bits (empty when not allocated).
+    std::vector< std::vector<Word> > myPages;
+    /// The surfels, when the set is not a bitmap.
+    SCellSet mySurfels;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the index of the bit of surfel \a s.
+    size_type bit( const SCell & s ) const;
+
+    /// @return the surfel of the given bit.
+    SCell cell( size_type b ) const;
+
+    /// @return the index of the first bit set from \a b, or myNbBits.
+    size_type nextBit( size_type b ) const;
+
+    /// @return 'true' if the given bit is set.
+    bool test( size_type b ) const;
+
+  }; // end of class SurfelBitSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelBitSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelBitSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfelBitSet<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SurfelBitSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelBitSet_h
+
+#undef SurfelBitSet_RECURSES
+#endif // else defined(SurfelBitSet_RECURSES)
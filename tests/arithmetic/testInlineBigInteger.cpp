@@ -0,0 +1,188 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testInlineBigInteger.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class InlineBigInteger.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/arithmetic/InlineBigInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#ifdef WITH_INLINE_BIGINTEGER
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class InlineBigInteger.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// @return a random integer of about \a bits bits, possibly negative.
+  BigInteger randomBigInteger( unsigned int bits )
+  {
+    BigInteger z = 0;
+    for ( unsigned int i = 0; i < bits; i += 15 )
+      z = z * 32768 + ( rand() % 32768 );
+    return ( rand() % 2 ) ? BigInteger( -z ) : z;
+  }
+
+  /// @return 'true' if \a x and \a z represent the same integer.
+  bool same( const InlineBigInteger & x, const BigInteger & z )
+  {
+    std::ostringstream sx, sz;
+    sx << x;
+    sz << z;
+    return sx.str() == sz.str() && x.toBigInteger() == z;
+  }
+}
+
+TEST_CASE( "Testing InlineBigInteger" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger< InlineBigInteger > ));
+
+  SECTION( "Construction, output and inline storage" )
+    {
+      InlineBigInteger a;
+      InlineBigInteger b = -12345;
+      InlineBigInteger c = DGtal::int64_t( 9000000000000000000LL );
+      REQUIRE( a == 0 );
+      REQUIRE( a.isInline() );
+      REQUIRE( b.sign() == -1 );
+      REQUIRE( same( c * c, BigInteger( "81000000000000000000000000000000000000" ) ) );
+      REQUIRE( ( c * c ).isInline() );
+      REQUIRE( ! ( c * c * c ).isInline() );
+      REQUIRE( ( c * c * c / c ).isInline() );
+      InlineBigInteger d( BigInteger( "-123456789012345678901234567890123456789012345" ) );
+      REQUIRE( ! d.isInline() );
+      REQUIRE( same( d, BigInteger( "-123456789012345678901234567890123456789012345" ) ) );
+      std::istringstream in( "-98765432109876543210987654321 42" );
+      InlineBigInteger e, f;
+      in >> e >> f;
+      REQUIRE( same( e, BigInteger( "-98765432109876543210987654321" ) ) );
+      REQUIRE( f == 42 );
+      REQUIRE( NumberTraits<InlineBigInteger>::castToInt64_t( f ) == 42 );
+      REQUIRE( NumberTraits<InlineBigInteger>::even( f ) );
+      REQUIRE( NumberTraits<InlineBigInteger>::odd( b ) );
+    }
+
+  SECTION( "Arithmetic is exact across the 128-bit boundary" )
+    {
+      unsigned int nbok = 0;
+      unsigned int nb = 0;
+      const unsigned int sizes[] = { 15, 60, 120, 127, 135, 200 };
+      for ( unsigned int i = 0; i < 600; ++i )
+        {
+          BigInteger za = randomBigInteger( sizes[ i % 6 ] );
+          BigInteger zb = randomBigInteger( sizes[ ( i / 6 ) % 6 ] );
+          if ( zb == 0 ) zb = 1;
+          InlineBigInteger a( za ), b( zb );
+          nbok += same( a + b, BigInteger( za + zb ) ) ? 1 : 0;
+          nbok += same( a - b, BigInteger( za - zb ) ) ? 1 : 0;
+          nbok += same( a * b, BigInteger( za * zb ) ) ? 1 : 0;
+          nbok += same( a / b, BigInteger( za / zb ) ) ? 1 : 0;
+          nbok += same( a % b, BigInteger( za % zb ) ) ? 1 : 0;
+          nbok += same( -a, BigInteger( -za ) ) ? 1 : 0;
+          nbok += ( ( a < b ) == ( za < zb ) ) ? 1 : 0;
+          nbok += ( ( a == b ) == ( za == zb ) ) ? 1 : 0;
+          InlineBigInteger c = a;
+          c *= b; c += a; c -= b; c /= b;
+          BigInteger zc = ( za * zb + za - zb ) / zb;
+          nbok += same( c, zc ) ? 1 : 0;
+          nb += 9;
+        }
+      REQUIRE( nbok == nb );
+    }
+
+  SECTION( "Inline overflows of the fast paths" )
+    {
+      BigInteger z127 = 1;
+      for ( int i = 0; i < 127; ++i ) z127 *= 2;
+      InlineBigInteger max( BigInteger( z127 - 1 ) );
+      REQUIRE( max.isInline() );
+      REQUIRE( same( max + 1, z127 ) );
+      REQUIRE( same( -max - 1, BigInteger( -z127 ) ) );
+      REQUIRE( same( ( -max - 1 ) / -1, z127 ) );
+      REQUIRE( ( -max - 1 ) % -1 == 0 );
+      REQUIRE( same( max * 2, BigInteger( z127 * 2 - 2 ) ) );
+      REQUIRE( ( max + 1 ) - 1 == max );
+      REQUIRE( ( ( max + 1 ) - 1 ).isInline() );
+      InlineBigInteger m = max;
+      ++m;
+      REQUIRE( ! m.isInline() );
+      --m;
+      REQUIRE( m == max );
+    }
+
+  SECTION( "IntegerComputer with InlineBigInteger" )
+    {
+      IntegerComputer<InlineBigInteger> ic;
+      InlineBigInteger a = InlineBigInteger( 1234567891 ) * 987654321 * 1000000007;
+      InlineBigInteger b = InlineBigInteger( 1234567891 ) * 1000000009;
+      REQUIRE( ic.gcd( a, b ) == 1234567891 );
+      REQUIRE( ic.floorDiv( InlineBigInteger( -7 ), InlineBigInteger( 2 ) ) == -4 );
+      REQUIRE( ic.ceilDiv( InlineBigInteger( -7 ), InlineBigInteger( 2 ) ) == -3 );
+    }
+}
+
+TEST_CASE( "Testing COBANaivePlaneComputer with InlineBigInteger" )
+{
+  typedef COBANaivePlaneComputer<Z3i::Space, InlineBigInteger> NaivePlaneComputer;
+  typedef COBANaivePlaneComputer<Z3i::Space, BigInteger> BigNaivePlaneComputer;
+  NaivePlaneComputer plane;
+  BigNaivePlaneComputer bigPlane;
+  plane.init( 2, 2000, 1, 1 );
+  bigPlane.init( 2, 2000, 1, 1 );
+  // points of the naive plane 12x + 35y + 1001z = 0 and outliers.
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  for ( int i = 0; i < 200; ++i )
+    {
+      Z3i::Point p( ( rand() % 2000 ) - 1000, ( rand() % 2000 ) - 1000, 0 );
+      IntegerComputer<DGtal::int64_t> ic;
+      p[ 2 ] = (Z3i::Integer) ic.ceilDiv( - 12 * p[ 0 ] - 35 * p[ 1 ], 1001 );
+      if ( i % 20 == 19 ) p[ 2 ] += 7;
+      nbok += ( plane.extend( p ) == bigPlane.extend( p ) ) ? 1 : 0;
+      ++nb;
+    }
+  REQUIRE( nbok == nb );
+  REQUIRE( plane.size() == bigPlane.size() );
+  REQUIRE( plane.complexity() == bigPlane.complexity() );
+}
+
+#endif // WITH_INLINE_BIGINTEGER
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
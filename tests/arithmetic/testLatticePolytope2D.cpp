@@ -34,6 +34,7 @@
 
 #include "DGtal/base/Common.h"
 #include "DGtal/arithmetic/LatticePolytope2D.h"
+#include "DGtal/arithmetic/InlineBigInteger.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/io/boards/Board2D.h"
 
@@ -386,6 +387,9 @@ int main( int, char** )
   typedef SpaceND<2, DGtal::BigInteger> Z2I;
   bool res = testLatticePolytope2D<Z2>()
     && testLatticePolytope2D<Z2I>()
+#ifdef WITH_INLINE_BIGINTEGER
+    && testLatticePolytope2D< SpaceND<2, DGtal::InlineBigInteger> >()
+#endif
     && exhaustiveTestLatticePolytope2D<Z2>()
     && checkOutputConvexHullBorder<Z2>();
   //&& specificTestLatticePolytope2D<Z2>();
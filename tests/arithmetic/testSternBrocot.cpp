@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
@@ -861,6 +862,51 @@ testSimplestFractionInBetween()
 
 
 
+/**
+ * Builds fractions concurrently in a fresh tree, then checks that
+ * they are correct and that each one is a unique node of the tree.
+ */
+template <typename SB>
+bool testConcurrentFractions()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Fraction Fraction;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: concurrent expansion of the tree." );
+  IntegerComputer<Integer> ic;
+  const std::ptrdiff_t n = 2000;
+  std::vector<Integer> ps( n ), qs( n );
+  for ( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      ps[ i ] = ( rand() % 500 ) + 1;
+      qs[ i ] = ( rand() % 500 ) + 1;
+    }
+  std::vector<Fraction> fractions( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for num_threads( 4 ) schedule( dynamic, 16 )
+#endif
+  for ( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      fractions[ i ] = SB::fraction( ps[ i ], qs[ i ] );
+      fractions[ i ].right().left().father();
+    }
+  for ( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      Integer g = ic.gcd( ps[ i ], qs[ i ] );
+      nbok += fractions[ i ].equals( ps[ i ] / g, qs[ i ] / g ) ? 1 : 0;
+      nbok += ( SB::fraction( ps[ i ], qs[ i ] ) == fractions[ i ] ) ? 1 : 0;
+      nbok += ( fractions[ i ].inverse().inverse() == fractions[ i ] ) ? 1 : 0;
+      nbok += ( fractions[ i ].left().father() == fractions[ i ] 
+                || fractions[ i ].left().previousPartial() == fractions[ i ] ) ? 1 : 0;
+      nb += 4;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") concurrent fractions, "
+               << "nbFractions = " << SB::instance().nbFractions << endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -879,7 +925,8 @@ int main( int , char** )
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
     && testAncestors<SB>()
-    && testSimplestFractionInBetween<SB>();
+    && testSimplestFractionInBetween<SB>()
+    && testConcurrentFractions< SternBrocot<DGtal::int64_t,DGtal::int64_t> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -498,6 +498,181 @@ test_duality()
     DGtal::trace.endBlock();
 }
 
+template <typename Calculus, DGtal::Order order, DGtal::Duality duality>
+bool
+test_sorted_indexes(const Calculus& calculus)
+{
+    typedef typename Calculus::SCells SCells;
+    typedef typename Calculus::Index Index;
+
+    const SCells& signed_cells = calculus.template getIndexedSCells<order, duality>();
+    if (static_cast<Index>(signed_cells.size()) != calculus.kFormLength(order, duality)) return false;
+
+    for (Index index=0; index<static_cast<Index>(signed_cells.size()); index++)
+    {
+        const typename Calculus::Cell cell = calculus.myKSpace.unsigns(signed_cells[index]);
+        if (calculus.getCellIndex(cell) != index) return false;
+        if (index > 0 && !(calculus.myKSpace.unsigns(signed_cells[index-1]) < cell)) return false;
+    }
+
+    return true;
+}
+
+// reference assembly, looking up every cell index through getCellIndex
+template <typename Calculus, DGtal::Order order, DGtal::Duality duality>
+typename Calculus::SparseMatrix
+lookup_derivative(const Calculus& calculus)
+{
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::SCell SCell;
+    typedef typename Calculus::LinearAlgebraBackend::Triplet Triplet;
+
+    const DGtal::Dimension dim_output = ( duality == DGtal::PRIMAL ? order+1 : Calculus::dimensionEmbedded-order-1 );
+
+    std::vector<Triplet> triplets;
+    for (typename Calculus::ConstIterator iter = calculus.begin(), iter_end = calculus.end(); iter!=iter_end; iter++)
+    {
+        const Cell& cell = iter->first;
+        if (calculus.myKSpace.uDim(cell) != dim_output) continue;
+
+        const SCell signed_cell = calculus.myKSpace.signs(cell, calculus.isCellFlipped(cell) ? KSpace::NEG : KSpace::POS);
+        const typename KSpace::SCells border = ( duality == DGtal::PRIMAL ? calculus.myKSpace.sLowerIncident(signed_cell) : calculus.myKSpace.sUpperIncident(signed_cell) );
+        for (typename KSpace::SCells::const_iterator bi=border.begin(), bie=border.end(); bi!=bie; bi++)
+        {
+            const Cell cell_border = calculus.myKSpace.unsigns(*bi);
+            if (!calculus.containsCell(cell_border)) continue;
+
+            const bool flipped_border = ( calculus.myKSpace.sSign(*bi) == KSpace::NEG );
+            triplets.push_back( Triplet(calculus.getCellIndex(cell), calculus.getCellIndex(cell_border), flipped_border == calculus.isCellFlipped(cell_border) ? 1 : -1) );
+        }
+    }
+
+    typename Calculus::SparseMatrix matrix(calculus.kFormLength(order+1, duality), calculus.kFormLength(order, duality));
+    matrix.setFromTriplets(triplets.begin(), triplets.end());
+    if ( duality == DGtal::DUAL && order*(Calculus::dimensionEmbedded-order)%2 != 0 ) return -1 * matrix;
+    return matrix;
+}
+
+template <typename Calculus, DGtal::Order order, DGtal::Duality duality>
+typename Calculus::SparseMatrix
+lookup_hodge(const Calculus& calculus)
+{
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::LinearAlgebraBackend::Triplet Triplet;
+
+    const DGtal::Dimension dim = ( duality == DGtal::PRIMAL ? order : Calculus::dimensionEmbedded-order );
+
+    std::vector<Triplet> triplets;
+    for (typename Calculus::ConstIterator iter = calculus.begin(), iter_end = calculus.end(); iter!=iter_end; iter++)
+    {
+        const Cell& cell = iter->first;
+        if (calculus.myKSpace.uDim(cell) != dim) continue;
+
+        const typename Calculus::Scalar size_ratio = ( duality == DGtal::PRIMAL ?
+            iter->second.dual_size/iter->second.primal_size :
+            iter->second.primal_size/iter->second.dual_size );
+        const typename Calculus::Index index = calculus.getCellIndex(cell);
+        triplets.push_back( Triplet(index, index, calculus.hodgeSign(cell, duality) * size_ratio) );
+    }
+
+    typename Calculus::SparseMatrix matrix(calculus.kFormLength(order, duality), calculus.kFormLength(order, duality));
+    matrix.setFromTriplets(triplets.begin(), triplets.end());
+    return matrix;
+}
+
+template <typename Calculus, int order>
+struct IndexTester
+{
+    BOOST_STATIC_ASSERT(( order <= (int)Calculus::dimensionEmbedded ));
+
+    static bool test(const Calculus& calculus)
+    {
+        DGtal::trace.info() << "testing sorted indexes and hodge assembly order " << order << std::endl;
+
+        if (!test_sorted_indexes<Calculus, order, DGtal::PRIMAL>(calculus)) return false;
+        if (!test_sorted_indexes<Calculus, order, DGtal::DUAL>(calculus)) return false;
+
+        if (!equal(calculus.template hodge<order, DGtal::PRIMAL>().myContainer, lookup_hodge<Calculus, order, DGtal::PRIMAL>(calculus))) return false;
+        if (!equal(calculus.template hodge<order, DGtal::DUAL>().myContainer, lookup_hodge<Calculus, order, DGtal::DUAL>(calculus))) return false;
+
+        return IndexTester<Calculus, order-1>::test(calculus);
+    }
+};
+
+template <typename Calculus>
+struct IndexTester<Calculus, -1>
+{
+    static bool test(const Calculus& )
+    {
+        return true;
+    }
+};
+
+template <typename Calculus, int order>
+struct DerivativeAssemblyTester
+{
+    BOOST_STATIC_ASSERT(( order < (int)Calculus::dimensionEmbedded ));
+
+    static bool test(const Calculus& calculus)
+    {
+        DGtal::trace.info() << "testing derivative assembly order " << order << std::endl;
+
+        if (!equal(calculus.template derivative<order, DGtal::PRIMAL>().myContainer, lookup_derivative<Calculus, order, DGtal::PRIMAL>(calculus))) return false;
+        if (!equal(calculus.template derivative<order, DGtal::DUAL>().myContainer, lookup_derivative<Calculus, order, DGtal::DUAL>(calculus))) return false;
+
+        return DerivativeAssemblyTester<Calculus, order-1>::test(calculus);
+    }
+};
+
+template <typename Calculus>
+struct DerivativeAssemblyTester<Calculus, -1>
+{
+    static bool test(const Calculus& )
+    {
+        return true;
+    }
+};
+
+template <typename DigitalSet, typename LinearAlgebraBackend>
+void
+test_indexes(int domain_size)
+{
+    BOOST_CONCEPT_ASSERT(( DGtal::concepts::CDigitalSet<DigitalSet> ));
+
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename DigitalSet::Point Point;
+    DGtal::trace.info() << "dimension=" << Point::dimension << std::endl;
+    Domain domain(Point(), Point::diagonal(domain_size-1));
+    DGtal::trace.info() << "domain=" << domain << std::endl;
+
+    DigitalSet set(domain);
+    for (typename Domain::ConstIterator di=domain.begin(), die=domain.end(); di!=die; di++)
+    {
+        if (std::rand()%3==0) continue;
+        const typename Domain::Point& point = *di;
+        set.insertNew(point);
+    }
+    DGtal::trace.info() << "set.size()=" << set.size() << std::endl;
+
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef DGtal::DiscreteExteriorCalculus<Domain::Space::dimension, Domain::Space::dimension, LinearAlgebraBackend> Calculus;
+
+    for (int add_border=0; add_border<2; add_border++)
+    {
+        DGtal::trace.beginBlock(add_border ? "testing indexes with border" : "testing indexes without border");
+        const Calculus calculus = CalculusFactory::createFromDigitalSet(set, add_border != 0);
+
+        bool test_result = IndexTester<Calculus, (int)Calculus::dimensionEmbedded>::test(calculus);
+        FATAL_ERROR(test_result);
+
+        test_result = DerivativeAssemblyTester<Calculus, (int)Calculus::dimensionEmbedded-1>::test(calculus);
+        FATAL_ERROR(test_result);
+
+        DGtal::trace.endBlock();
+    }
+}
+
 template <typename LinearAlgebraBackend>
 void
 test_backend(const int& ntime, const int& maxdim)
@@ -538,6 +713,12 @@ test_backend(const int& ntime, const int& maxdim)
         if (maxdim>=7) test_hodge<DigitalSet7, LinearAlgebraBackend>(2);
         DGtal::trace.endBlock();
 
+        DGtal::trace.beginBlock("testing indexes");
+        if (maxdim>=1) test_indexes<DigitalSet1, LinearAlgebraBackend>(10);
+        if (maxdim>=2) test_indexes<DGtal::Z2i::DigitalSet, LinearAlgebraBackend>(5);
+        if (maxdim>=3) test_indexes<DGtal::Z3i::DigitalSet, LinearAlgebraBackend>(4);
+        DGtal::trace.endBlock();
+
         DGtal::trace.beginBlock("testing derivatives");
         if (maxdim>=1) test_derivative<DigitalSet1, LinearAlgebraBackend>(10);
         if (maxdim>=2) test_derivative<DGtal::Z2i::DigitalSet, LinearAlgebraBackend>(5);
@@ -0,0 +1,116 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculus-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of DiscreteExteriorCalculusFactory::createFromNSCells and
+ * of operator assembly on digital spheres of increasing size.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class DiscreteExteriorCalculus.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkSphere( const int radius )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef DiscreteExteriorCalculus<2, 3, EigenLinearAlgebraBackend> Calculus;
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+  trace.beginBlock( "Benchmarking sphere of radius " + std::to_string( radius ) );
+
+  const Z3i::Point p1 = Z3i::Point::diagonal( -radius - 2 );
+  const Z3i::Point p2 = Z3i::Point::diagonal(  radius + 2 );
+  const Z3i::Domain domain( p1, p2 );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( 0 ), radius );
+
+  KSpace kspace;
+  kspace.init( p1, p2, true );
+  std::vector<KSpace::SCell> surfels;
+  std::back_insert_iterator< std::vector<KSpace::SCell> > out_it( surfels );
+  Surfaces<KSpace>::sWriteBoundary( out_it, kspace, set, p1, p2 );
+  trace.info() << surfels.size() << " surfels" << std::endl;
+
+  trace.beginBlock( "createFromNSCells" );
+  const Calculus calculus = CalculusFactory::createFromNSCells<2>( surfels.begin(), surfels.end() );
+  trace.info() << calculus << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "derivatives and hodges" );
+  const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+  const Calculus::PrimalDerivative1 d1 = calculus.derivative<1, PRIMAL>();
+  const Calculus::PrimalHodge1 h1 = calculus.hodge<1, PRIMAL>();
+  const Calculus::DualHodge1 h1p = calculus.hodge<1, DUAL>();
+  trace.endBlock();
+
+  trace.beginBlock( "laplace" );
+  const Calculus::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+  trace.endBlock();
+
+  trace.beginBlock( "flat and sharp" );
+  const Calculus::PrimalForm1 one_form( calculus );
+  const Calculus::PrimalVectorField field = calculus.sharp( one_form );
+  const Calculus::PrimalForm1 flat_form = calculus.flat( field );
+  trace.endBlock();
+
+  trace.endBlock();
+
+  return d0.myContainer.rows() == d1.myContainer.cols()
+    && h1.myContainer.rows() == h1p.myContainer.cols()
+    && laplace.myContainer.rows() == calculus.kFormLength( 0, PRIMAL )
+    && flat_form.length() == calculus.kFormLength( 1, PRIMAL );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking DiscreteExteriorCalculus" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  for ( int radius = 16; radius <= 128; radius *= 2 )
+    res = res && benchmarkSphere( radius );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,161 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMatrixFreeCalculus.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class MatrixFreeCalculus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/MatrixFreeCalculus.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MatrixFreeCalculus.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TForm>
+double
+maxDifference(const TForm& a, const TForm& b)
+{
+  return ( a.myContainer - b.myContainer ).cwiseAbs().maxCoeff();
+}
+
+TEST_CASE( "Testing MatrixFreeCalculus on a 2D regular grid" )
+{
+  typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  typedef MatrixFreeCalculus<Calculus> MFCalculus;
+
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 15, 11 ) );
+  Z2i::DigitalSet set( domain );
+  Shapes<Z2i::Domain>::addNorm2Ball( set, Z2i::Point( 7, 5 ), 6 );
+  Shapes<Z2i::Domain>::removeNorm2Ball( set, Z2i::Point( 7, 5 ), 2 );
+
+  const Calculus calculus = CalculusFactory::createFromDigitalSet( set );
+  const MFCalculus mf_calculus( calculus );
+
+  Calculus::PrimalForm0 primal_zero( calculus );
+  for ( Calculus::Index i = 0; i < primal_zero.length(); i++ )
+    primal_zero.myContainer( i ) = cos( 0.3 * i );
+  Calculus::DualForm0 dual_zero( calculus );
+  for ( Calculus::Index i = 0; i < dual_zero.length(); i++ )
+    dual_zero.myContainer( i ) = sin( 0.2 * i );
+  Calculus::PrimalForm1 primal_one( calculus );
+  for ( Calculus::Index i = 0; i < primal_one.length(); i++ )
+    primal_one.myContainer( i ) = cos( 0.1 * i );
+
+  SECTION( "Index image" )
+    {
+      for ( Calculus::ConstIterator it = calculus.begin(), ite = calculus.end(); it != ite; ++it )
+        REQUIRE( mf_calculus.getCellIndex( it->first ) == it->second.index );
+    }
+
+  SECTION( "Derivatives are equal to assembled ones" )
+    {
+      REQUIRE( maxDifference( mf_calculus.derivative( primal_zero ), calculus.derivative<0, PRIMAL>() * primal_zero ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.derivative( primal_one ), calculus.derivative<1, PRIMAL>() * primal_one ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.derivative( dual_zero ), calculus.derivative<0, DUAL>() * dual_zero ) < 1e-10 );
+    }
+
+  SECTION( "Hodges and antiderivatives are equal to assembled ones" )
+    {
+      REQUIRE( maxDifference( mf_calculus.hodge( primal_zero ), calculus.hodge<0, PRIMAL>() * primal_zero ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.hodge( primal_one ), calculus.hodge<1, PRIMAL>() * primal_one ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.antiderivative( primal_one ), calculus.antiderivative<1, PRIMAL>() * primal_one ) < 1e-10 );
+    }
+
+  SECTION( "Laplaces are equal to assembled ones" )
+    {
+      REQUIRE( maxDifference( mf_calculus.laplace( primal_zero ), calculus.laplace<PRIMAL>() * primal_zero ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.laplace( dual_zero ), calculus.laplace<DUAL>() * dual_zero ) < 1e-10 );
+    }
+
+  SECTION( "Solving with an iterative solver" )
+    {
+      typedef MatrixFreeLaplace<Calculus, DUAL> Operator;
+      const Operator op = mf_calculus.laplaceOperator<DUAL>( 1., -0.5 );
+
+      const Calculus::DualIdentity0 assembled = calculus.identity<0, DUAL>() - 0.5 * calculus.laplace<DUAL>();
+      REQUIRE( maxDifference( op * dual_zero, assembled * dual_zero ) < 1e-10 );
+
+      // dual laplace is not symmetric near the border
+      Eigen::BiCGSTAB<Operator, Eigen::IdentityPreconditioner> bicgstab;
+      bicgstab.setTolerance( 1e-12 );
+      bicgstab.compute( op );
+      const Calculus::DenseVector x = bicgstab.solve( dual_zero.myContainer );
+      REQUIRE( bicgstab.info() == Eigen::Success );
+
+      Eigen::SparseLU<Calculus::SparseMatrix> lu( assembled.myContainer );
+      const Calculus::DenseVector x_lu = lu.solve( dual_zero.myContainer );
+      REQUIRE( ( x - x_lu ).cwiseAbs().maxCoeff() < 1e-8 );
+    }
+}
+
+TEST_CASE( "Testing MatrixFreeCalculus on a 3D regular grid" )
+{
+  typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  typedef MatrixFreeCalculus<Calculus> MFCalculus;
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 7, 6, 5 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 3, 3, 2 ), 3 );
+
+  const Calculus calculus = CalculusFactory::createFromDigitalSet( set, false );
+  const MFCalculus mf_calculus( calculus );
+
+  Calculus::PrimalForm1 primal_one( calculus );
+  for ( Calculus::Index i = 0; i < primal_one.length(); i++ )
+    primal_one.myContainer( i ) = cos( 0.1 * i );
+  Calculus::DualForm1 dual_one( calculus );
+  for ( Calculus::Index i = 0; i < dual_one.length(); i++ )
+    dual_one.myContainer( i ) = sin( 0.3 * i );
+  Calculus::PrimalForm0 primal_zero( calculus );
+  for ( Calculus::Index i = 0; i < primal_zero.length(); i++ )
+    primal_zero.myContainer( i ) = cos( 0.7 * i );
+
+  SECTION( "Derivatives are equal to assembled ones" )
+    {
+      REQUIRE( maxDifference( mf_calculus.derivative( primal_one ), calculus.derivative<1, PRIMAL>() * primal_one ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.derivative( dual_one ), calculus.derivative<1, DUAL>() * dual_one ) < 1e-10 );
+    }
+
+  SECTION( "Antiderivatives and laplaces are equal to assembled ones" )
+    {
+      REQUIRE( maxDifference( mf_calculus.antiderivative( dual_one ), calculus.antiderivative<1, DUAL>() * dual_one ) < 1e-10 );
+      REQUIRE( maxDifference( mf_calculus.laplace( primal_zero ), calculus.laplace<PRIMAL>() * primal_zero ) < 1e-10 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/ShapeFactory.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  typedef FreemanChain<int> FC;
+  typedef PackedFreemanChain<int> PackedFC;
+
+  /// @return 'true' if \a pc has the same codes, points, bounding box
+  /// and number of loops as \a fc.
+  bool sameChain( const PackedFC & pc, const FC & fc )
+  {
+    if ( ( pc.size() != fc.size() ) || ! pc.isValid() ) return false;
+    for ( unsigned int i = 0; i < fc.size(); ++i )
+      if ( pc.code( i ) != static_cast<unsigned int>( fc.code( i ) - '0' ) )
+        return false;
+    std::vector<FC::Point> points, packedPoints;
+    FC::getContourPoints( fc, points );
+    pc.getContourPoints( packedPoints );
+    if ( points != packedPoints ) return false;
+    int min_x, min_y, max_x, max_y;
+    int pmin_x, pmin_y, pmax_x, pmax_y;
+    fc.computeBoundingBox( min_x, min_y, max_x, max_y );
+    pc.computeBoundingBox( pmin_x, pmin_y, pmax_x, pmax_y );
+    if ( ( min_x != pmin_x ) || ( min_y != pmin_y )
+         || ( max_x != pmax_x ) || ( max_y != pmax_y ) )
+      return false;
+    if ( fc.ccwLoops() != pc.ccwLoops() ) return false;
+    if ( pc.isClosed() != ( fc.isClosed() != 0 ) ) return false;
+    if ( pc.lastPoint() != fc.lastPoint() ) return false;
+    // twice the area with the shoelace formula.
+    int area = 0;
+    for ( unsigned int i = 0; i + 1 < points.size(); ++i )
+      area += points[ i ][ 0 ] * points[ i + 1 ][ 1 ]
+        - points[ i ][ 1 ] * points[ i + 1 ][ 0 ];
+    return area == pc.twiceSignedArea();
+  }
+}
+
+TEST_CASE( "Testing PackedFreemanChain" )
+{
+  SECTION( "Small chains" )
+    {
+      const std::string chains[] = { "", "0", "0123", "00112233", "0001112223",
+                                     "011122233300", "0303030303212121212" };
+      for ( unsigned int i = 0; i < 7; ++i )
+        {
+          FC fc( chains[ i ], 3, -5 );
+          PackedFC pc( chains[ i ], 3, -5 );
+          REQUIRE( sameChain( pc, fc ) );
+          REQUIRE( pc.toFreemanChain() == fc );
+          REQUIRE( sameChain( PackedFC( fc ), fc ) );
+        }
+      PackedFC square( "00112233" );
+      REQUIRE( square.twiceSignedArea() == 8 );
+      REQUIRE( square.ccwLoops() == 1 );
+      PackedFC cwSquare( "11003322" );
+      REQUIRE( cwSquare.twiceSignedArea() == -8 );
+      REQUIRE( cwSquare.ccwLoops() == -1 );
+    }
+
+  SECTION( "Chains read from files" )
+    {
+      const std::string files[] = { "samples/contourS.fc", "samples/france.fc",
+                                    "samples/klokan.fc", "samples/BigBall2.fc" };
+      for ( unsigned int i = 0; i < 4; ++i )
+        {
+          std::string filename = testPath + files[ i ];
+          std::fstream fst;
+          fst.open( filename.c_str(), std::ios::in );
+          FC fc( fst );
+          PackedFC pc( fc );
+          REQUIRE( sameChain( pc, fc ) );
+          std::vector<FC::Point> points;
+          FC::getContourPoints( fc, points );
+          PackedFC pc2;
+          pc2.readFromPointsRange( points.begin(), points.end() );
+          REQUIRE( sameChain( pc2, fc ) );
+        }
+    }
+
+  SECTION( "Random chains" )
+    {
+      srand( 0 );
+      for ( unsigned int i = 0; i < 50; ++i )
+        {
+          std::string s( rand() % 300, '0' );
+          for ( unsigned int j = 0; j < s.size(); ++j )
+            s[ j ] = static_cast<char>( '0' + ( rand() % 4 ) );
+          FC fc( s, rand() % 100, rand() % 100 );
+          REQUIRE( sameChain( PackedFC( fc ), fc ) );
+        }
+    }
+
+  SECTION( "Boundary of a digitized shape" )
+    {
+      typedef ImplicitBall<Z2i::Space> Shape;
+      typedef GaussDigitizer<Z2i::Space, Shape> Digitizer;
+      Shape ball( Z2i::RealPoint( 0.0, 0.0 ), 30.0 );
+      Digitizer dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.5 );
+      Z2i::KSpace K;
+      REQUIRE( K.init( dig.getLowerBound() - Z2i::Point::diagonal( 1 ),
+                       dig.getUpperBound() + Z2i::Point::diagonal( 1 ), true ) );
+      SurfelAdjacency<2> SAdj( true );
+      Z2i::SCell bel = Surfaces<Z2i::KSpace>::findABel( K, dig, 10000 );
+      std::vector<Z2i::Point> points;
+      Surfaces<Z2i::KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      FC fc( points );
+      PackedFC pc;
+      pc.readFrom2DBoundary( K, SAdj, dig, bel );
+      REQUIRE( sameChain( pc, fc ) );
+      PackedFC closed;
+      closed.readFrom2DBoundary( K, SAdj, dig, bel, true );
+      REQUIRE( closed.size() == fc.size() + 1 );
+      REQUIRE( closed.isClosed() );
+      REQUIRE( closed.ccwLoops() == 1 );
+      // the area of the ball of radius 60 in grid steps.
+      REQUIRE( closed.twiceSignedArea() > 2 * 11000 );
+      REQUIRE( closed.twiceSignedArea() < 2 * 11700 );
+    }
+
+  SECTION( "Open boundary of a digitized shape cut by the bounds of an open space" )
+    {
+      typedef ImplicitBall<Z2i::Space> Shape;
+      typedef GaussDigitizer<Z2i::Space, Shape> Digitizer;
+      Shape ball( Z2i::RealPoint( 0.0, 0.0 ), 30.0 );
+      Digitizer dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.5 );
+      Z2i::KSpace K;
+      REQUIRE( K.init( Z2i::Point( -70, 0 ), Z2i::Point( 70, 70 ), false ) );
+      SurfelAdjacency<2> SAdj( true );
+      Z2i::SCell bel = K.sCell( Z2i::Point( 1, 2 * 66 ), K.POS );
+      while ( ! K.sIsSurfel( bel )
+              || dig( K.sCoords( K.sDirectIncident( bel, 1 ) ) )
+              == dig( K.sCoords( K.sIndirectIncident( bel, 1 ) ) ) )
+        bel = K.sCell( K.sKCoords( bel ) - Z2i::Point( 0, 2 ), K.POS );
+      std::vector<Z2i::Point> points;
+      Surfaces<Z2i::KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      FC fc( points );
+      PackedFC pc;
+      pc.readFrom2DBoundary( K, SAdj, dig, bel );
+      REQUIRE( fc.size() > 100 );
+      REQUIRE( sameChain( pc, fc ) );
+      REQUIRE( ! pc.isClosed() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -935,6 +935,76 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Checks that the segments computed chunk by chunk are the segments
+ * of the sequential traversal, for all modes, on the whole range and
+ * on a subrange.
+ */
+bool SaturatedSegmentationChunksTest()
+{
+
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+
+  typedef PointVector<2,Coordinate> Point; 
+
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+ 
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef ArithmeticalDSSComputer<ConstIterator,Coordinate,4> RecognitionAlgorithm;
+  typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+
+  trace.beginBlock("saturated Segmentation computed chunk by chunk");
+
+  const std::string modes[] = { "First", "First++", "MostCentered",
+                                "MostCentered++", "Last", "Last++" };
+  const std::size_t nbChunks[] = { 0, 1, 7, 1000 };
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  for ( unsigned int r = 0; r < 2; ++r )
+    for ( unsigned int m = 0; m < 6; ++m )
+      {
+        RecognitionAlgorithm algo;
+        Segmentation s( vPts.begin(), vPts.end(), algo );
+        if ( r == 1 )
+          s.setSubRange( vPts.begin() + 1000, vPts.begin() + 5000 );
+        s.setMode( modes[ m ] );
+        vector<RecognitionAlgorithm> expected;
+        for ( Segmentation::SegmentComputerIterator i = s.begin(), 
+                itEnd = s.end(); i != itEnd; ++i )
+          expected.push_back( *i );
+        for ( unsigned int k = 0; k < 4; ++k )
+          {
+            vector<RecognitionAlgorithm> segments;
+            s.computeSegments( segments, nbChunks[ k ] );
+            bool ok = segments.size() == expected.size();
+            for ( unsigned int j = 0; ok && ( j < segments.size() ); ++j )
+              ok = ( segments[ j ].begin() == expected[ j ].begin() )
+                && ( segments[ j ].end() == expected[ j ].end() )
+                && ( segments[ j ] == expected[ j ] );
+            ++nb; nbok += ok ? 1 : 0;
+            if ( ! ok )
+              trace.info() << "Error with mode " << modes[ m ]
+                           << ( r == 1 ? " (subrange)" : "" )
+                           << " and " << nbChunks[ k ] << " chunks: "
+                           << segments.size() << " segments instead of "
+                           << expected.size() << endl;
+          }
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") chunked segmentations" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1021,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& SaturatedSegmentationChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchPlaneComputer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class BatchPlaneComputer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/BatchPlaneComputer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchPlaneComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  typedef Z3i::Point Point;
+
+  /**
+   * Builds patches of points of random naive planes with dominant z
+   * component. One patch over three has an outlier in its second
+   * half.
+   */
+  void makePatches( std::vector< std::vector<Point> > & patches,
+                    unsigned int nbPatches, unsigned int nbPoints )
+  {
+    IntegerComputer<DGtal::int64_t> ic;
+    srand( 0 );
+    patches.resize( nbPatches );
+    for ( unsigned int i = 0; i < nbPatches; ++i )
+      {
+        DGtal::int64_t a = ( rand() % 41 ) - 20;
+        DGtal::int64_t b = ( rand() % 41 ) - 20;
+        DGtal::int64_t c = 21 + ( rand() % 20 );
+        std::vector<Point> & patch = patches[ i ];
+        patch.clear();
+        for ( unsigned int j = 0; j < nbPoints; ++j )
+          {
+            Point p( ( rand() % 41 ) - 20, ( rand() % 41 ) - 20, 0 );
+            p[ 2 ] = (Z3i::Integer) ic.ceilDiv( - a * p[ 0 ] - b * p[ 1 ], c );
+            patch.push_back( p );
+          }
+        if ( i % 3 == 0 )
+          patch[ nbPoints / 2 + ( rand() % ( nbPoints / 2 ) ) ][ 2 ] += 3;
+      }
+  }
+
+  /**
+   * Checks that the batch recognition gives the same results as the
+   * sequential recognition of each patch.
+   * @return the number of patches recognized as planes.
+   */
+  template <typename PlaneComputer>
+  unsigned int checkBatch( const PlaneComputer & model,
+                           const std::vector< std::vector<Point> > & patches )
+  {
+    typedef BatchPlaneComputer<PlaneComputer> Batch;
+    Batch batch( model );
+    for ( unsigned int i = 0; i < patches.size(); ++i )
+      REQUIRE( batch.addPatch( patches[ i ].begin(), patches[ i ].end() ) == i );
+    REQUIRE( batch.isValid() );
+    REQUIRE( batch.nbPatches() == patches.size() );
+    std::vector<typename Batch::Result> results;
+    batch.compute( results );
+    REQUIRE( results.size() == patches.size() );
+    unsigned int nbok = 0;
+    unsigned int nbPlanes = 0;
+    for ( unsigned int i = 0; i < patches.size(); ++i )
+      {
+        PlaneComputer plane( model );
+        unsigned int n = 0;
+        while ( ( n < patches[ i ].size() ) && plane.extend( patches[ i ][ n ] ) )
+          ++n;
+        const typename Batch::Result & r = results[ i ];
+        bool ok = ( r.nbPoints == patches[ i ].size() )
+          && ( r.nbRecognized == n )
+          && ( r.primitive.normal() == plane.primitive().normal() )
+          && ( r.primitive.mu() == plane.primitive().mu() );
+        nbok += ok ? 1 : 0;
+        nbPlanes += r.isPlane() ? 1 : 0;
+      }
+    REQUIRE( nbok == patches.size() );
+    // patches are reused after clear().
+    batch.clear();
+    REQUIRE( batch.nbPatches() == 0 );
+    REQUIRE( batch.nbPoints() == 0 );
+    batch.addPatch( patches[ 1 ].begin(), patches[ 1 ].end() );
+    batch.compute( results );
+    REQUIRE( results.size() == 1 );
+    REQUIRE( results[ 0 ].isPlane() );
+    return nbPlanes;
+  }
+}
+
+TEST_CASE( "Testing BatchPlaneComputer" )
+{
+  std::vector< std::vector<Point> > patches;
+  makePatches( patches, 300, 40 );
+
+  SECTION( "With COBANaivePlaneComputer" )
+    {
+      COBANaivePlaneComputer<Z3i::Space, DGtal::int64_t> model;
+      model.init( 2, 100, 1, 1 );
+      REQUIRE( checkBatch( model, patches ) == 200 );
+    }
+
+  SECTION( "With COBAGenericNaivePlaneComputer" )
+    {
+      COBAGenericNaivePlaneComputer<Z3i::Space, DGtal::int64_t> model;
+      model.init( 100, 1, 1 );
+      REQUIRE( checkBatch( model, patches ) == 200 );
+    }
+
+  SECTION( "With ChordNaivePlaneComputer" )
+    {
+      ChordNaivePlaneComputer<Z3i::Space, Point, DGtal::int64_t> model;
+      model.init( 2, 1, 1 );
+      REQUIRE( checkBatch( model, patches ) == 200 );
+    }
+
+  SECTION( "With ChordGenericNaivePlaneComputer" )
+    {
+      ChordGenericNaivePlaneComputer<Z3i::Space, Point, DGtal::int64_t> model;
+      model.init( 1, 1 );
+      REQUIRE( checkBatch( model, patches ) == 200 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/arithmetic/InlineBigInteger.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -142,13 +143,38 @@ checkGenericPlanes( unsigned int nbplanes, int diameter, unsigned int nbpoints,
 }
 
 
+/**
+ * Checks random planes with the given computer and outputs timings.
+ * @param name the name of the internal integer type.
+ */
+template <typename NaivePlaneComputer>
+bool
+benchmarkCOBAGenericNaivePlaneComputer( const std::string & name, unsigned int nbtries,
+                  unsigned int nbpoints, unsigned int diameter )
+{
+  Statistic<double> stats;
+  srand( 0 ); // same planes for all integer types.
+  trace.beginBlock ( "Testing class COBAGenericNaivePlaneComputer with " + name );
+  bool res = checkGenericPlanes<NaivePlaneComputer>( nbtries, diameter, nbpoints, stats );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  long t = trace.endBlock();
+  stats.terminate();
+  std::cout << name << " " << stats.samples()
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( (double) t / (double) stats.samples() )
+            << " " << stats.mean()
+            << " " << stats.variance()
+            << std::endl;
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int argc, char** argv )
 {
   using namespace Z3i;
-  Statistic<double> stats;
   unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
   unsigned int nbpoints = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100;
   unsigned int diameter = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 100;
@@ -157,19 +183,12 @@ int main( int argc, char** argv )
   std::cout << "# Integer nbtries nbpoints diameter time/plane(ms) E(comp) V(comp)" << std::endl;
   
  // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
-  trace.beginBlock ( "Testing class COBAGenericNaivePlaneComputer" );
-  bool res = true 
-    && checkGenericPlanes<COBAGenericNaivePlaneComputer<Z3, DGtal::BigInteger> >( nbtries, diameter, nbpoints, stats );
-  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
-  long t = trace.endBlock();
-  stats.terminate();
-  std::cout << "BigInteger" << " " << stats.samples()
-            << " " << nbpoints
-            << " " << diameter 
-            << " " << ( (double) t / (double) stats.samples() )
-            << " " << stats.mean()
-            << " " << stats.variance()
-            << std::endl;
+  bool res = benchmarkCOBAGenericNaivePlaneComputer< COBAGenericNaivePlaneComputer<Z3, DGtal::BigInteger> >
+    ( "BigInteger", nbtries, nbpoints, diameter );
+#ifdef WITH_INLINE_BIGINTEGER
+  res = res && benchmarkCOBAGenericNaivePlaneComputer< COBAGenericNaivePlaneComputer<Z3, DGtal::InlineBigInteger> >
+    ( "InlineBigInteger", nbtries, nbpoints, diameter );
+#endif
   return res ? 0 : 1;
 }
 //                                                                           //
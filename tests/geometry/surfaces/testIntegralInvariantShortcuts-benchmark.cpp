@@ -0,0 +1,103 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegralInvariantShortcuts-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Benchmarks the integral invariant estimations of ShortcutsGeometry
+ * when the surfels are given in the order of the surface traversal or
+ * sorted along a Morton or Hilbert curve.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the surfel orders of Shortcuts.
+///////////////////////////////////////////////////////////////////////////////
+
+int main( int argc, char** argv )
+{
+  typedef Shortcuts<Z3i::KSpace>         SH3;
+  typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+  const std::string polynomial = ( argc > 1 ) ? argv[ 1 ] : "goursat";
+  const double      gridstep   = ( argc > 2 ) ? atof( argv[ 2 ] ) : 0.1;
+  std::cout << "# Usage: " << argv[0] << " <polynomial> <gridstep>." << std::endl;
+  std::cout << "# Estimates II mean curvatures and normals on the surfels of the digitized shape, given in several orders." << std::endl;
+
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", polynomial )( "gridstep", gridstep )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  const auto surfels   = SH3::getSurfelRange( surface, params );
+
+  std::cout << "# Order nbsurfels time-permutation(ms) time-II-mean(ms) time-II-normal(ms)" << std::endl;
+  const std::string orders[] = { "Default", "BreadthFirst", "Morton", "Hilbert" };
+  SH3::Scalars reference;
+  bool ok = true;
+  for ( auto&& order : orders )
+    {
+      trace.beginBlock( "Ordering surfels (" + order + ")" );
+      SH3::SurfelRange sorted = surfels;
+      SH3::IdxRange    perm;
+      if ( order == "BreadthFirst" )
+        sorted = SH3::getSurfelRange( surface, Parameters( "surfaceTraversal", order ) );
+      else
+        {
+          perm   = SH3::getSurfelPermutation( K, surfels, order );
+          sorted = SH3::getPermutedRange( surfels, perm );
+        }
+      double tPerm = trace.endBlock();
+
+      trace.beginBlock( "II mean curvatures (" + order + ")" );
+      auto H = SHG3::getIIMeanCurvatures( binary_image, sorted, params );
+      double tMean = trace.endBlock();
+
+      trace.beginBlock( "II normal vectors (" + order + ")" );
+      auto N = SHG3::getIINormalVectors( binary_image, sorted, params );
+      double tNormal = trace.endBlock();
+
+      if ( ! perm.empty() )
+        {
+          H = SH3::getUnpermutedRange( H, perm );
+          if ( reference.empty() ) reference = H;
+          ok = ok && ( H == reference );
+        }
+      std::cout << order << " " << sorted.size() << " " << tPerm
+                << " " << tMean << " " << tNormal << std::endl;
+    }
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <cstdio>
+#include <string>
 
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
@@ -84,6 +86,62 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
     for(std::size_t i = 0; i < G.size(); ++i)
      REQUIRE( Kcurv[i] == Approx( G[i] ) );
   }
+
+  SECTION("Testing that streamed normals and mean curvatures are the same")
+  {
+    params( "chunkSize", 500 );
+    SH3::SurfelRange streamed_surfels;
+    SH3::RealVectors streamed_normals;
+    SH3::Scalars     streamed_curvatures;
+    unsigned int     nb_ko = 0;
+    // Sinks may run in another thread: they only count errors.
+    auto nb = SHG3::streamIINormalVectors( binary_image, surface,
+      [&] ( const SH3::SurfelRange& chunk, const SH3::RealVectors& normals )
+      {
+        nb_ko += chunk.size() == normals.size() ? 0 : 1;
+        streamed_surfels.insert( streamed_surfels.end(), chunk.begin(), chunk.end() );
+        streamed_normals.insert( streamed_normals.end(), normals.begin(), normals.end() );
+      }, params );
+    SHG3::streamIIMeanCurvatures( binary_image, surface,
+      [&] ( const SH3::SurfelRange& chunk, const SH3::Scalars& curvatures )
+      {
+        nb_ko += chunk.size() == curvatures.size() ? 0 : 1;
+        streamed_curvatures.insert( streamed_curvatures.end(),
+                                    curvatures.begin(), curvatures.end() );
+      }, params );
+    REQUIRE( nb_ko == 0 );
+    REQUIRE( nb == surfels.size() );
+    REQUIRE( streamed_surfels == surfels );
+    REQUIRE( streamed_normals    == SHG3::getIINormalVectors( binary_image, surfels, params ) );
+    REQUIRE( streamed_curvatures == SHG3::getIIMeanCurvatures( binary_image, surfels, params ) );
+  }
+
+  SECTION("Testing that cached normals and mean curvatures are read back")
+  {
+    auto normals    = SHG3::getCachedIINormalVectors( binary_image, surfels, params );
+    auto curvatures = SHG3::getCachedIIMeanCurvatures( binary_image, surfels, params );
+    REQUIRE( normals    == SHG3::getIINormalVectors( binary_image, surfels, params ) );
+    REQUIRE( curvatures == SHG3::getIIMeanCurvatures( binary_image, surfels, params ) );
+    const std::string dir = params[ "cacheDirectory" ].as<std::string>() + "/";
+    const std::string nfile = dir
+      + SH3::getCacheKey( binary_image, params, "IINormalVectors", surfels ) + ".vectors";
+    const std::string hfile = dir
+      + SH3::getCacheKey( binary_image, params, "IIMeanCurvatures", surfels ) + ".scalars";
+    SH3::RealVectors cached_normals;
+    SH3::Scalars     cached_curvatures;
+    REQUIRE( SH3::loadCachedRealVectors( cached_normals, nfile ) );
+    REQUIRE( SH3::loadCachedScalars( cached_curvatures, hfile ) );
+    REQUIRE( cached_normals    == normals );
+    REQUIRE( cached_curvatures == curvatures );
+    REQUIRE( SHG3::getCachedIINormalVectors( binary_image, surfels, params ) == normals );
+    REQUIRE( SHG3::getCachedIIMeanCurvatures( binary_image, surfels, params ) == curvatures );
+    // Other surfels do not give the same key.
+    SH3::SurfelRange half( surfels.begin(), surfels.begin() + surfels.size() / 2 );
+    REQUIRE( SH3::getCacheKey( binary_image, params, "IINormalVectors", half )
+             != SH3::getCacheKey( binary_image, params, "IINormalVectors", surfels ) );
+    std::remove( nfile.c_str() );
+    std::remove( hfile.c_str() );
+  }
 }
 
 /** @ingroup Tests **/
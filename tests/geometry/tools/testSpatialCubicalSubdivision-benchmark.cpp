@@ -0,0 +1,126 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSpatialCubicalSubdivision-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of SpatialCubicalSubdivision: construction, box queries
+ * (as used by VoronoiCovarianceMeasure), radius and k-nearest queries
+ * on the points of digital spheres of increasing size.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class SpatialCubicalSubdivision.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkSphere( const int radius, const int r )
+{
+  typedef SpatialCubicalSubdivision<Space> Subdivision;
+
+  trace.beginBlock( "Benchmarking sphere of radius " + std::to_string( radius ) );
+  std::vector<Point> pts;
+  const Domain domain( Point::diagonal( -radius - r ), Point::diagonal( radius + r ) );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const double d = ( *it ).norm();
+      if ( radius - 0.5 <= d && d < radius + 0.5 ) pts.push_back( *it );
+    }
+  trace.info() << pts.size() << " points" << std::endl;
+
+  trace.beginBlock( "Construction" );
+  Subdivision sub( domain.lowerBound(), domain.upperBound(), r );
+  sub.push( pts.begin(), pts.end() );
+  sub.update();
+  trace.endBlock();
+
+  const double r2 = (double) r * r;
+  size_t nb_box = 0;
+  trace.beginBlock( "Box queries (3^d bins) filtered by distance" );
+  std::vector<Point> neighbors;
+  for ( std::vector<Point>::const_iterator it = pts.begin(), itE = pts.end(); it != itE; ++it )
+    {
+      neighbors.clear();
+      const Point b = sub.bin( *it );
+      sub.getPoints( neighbors, b - Point::diagonal( 1 ), b + Point::diagonal( 1 ) );
+      for ( std::vector<Point>::const_iterator q = neighbors.begin(); q != neighbors.end(); ++q )
+        nb_box += ( *q - *it ).squaredNorm() <= r2 ? 1 : 0;
+    }
+  trace.info() << nb_box << " neighbors" << std::endl;
+  trace.endBlock();
+
+  size_t nb_radius = 0;
+  trace.beginBlock( "Radius queries" );
+  for ( std::vector<Point>::const_iterator it = pts.begin(), itE = pts.end(); it != itE; ++it )
+    {
+      neighbors.clear();
+      sub.radiusSearch( neighbors, *it, r );
+      nb_radius += neighbors.size();
+    }
+  trace.info() << nb_radius << " neighbors" << std::endl;
+  trace.endBlock();
+
+  size_t nb_batch = 0;
+  trace.beginBlock( "Batch radius queries" );
+  std::vector< std::vector<Point> > results;
+  sub.radiusSearch( results, pts, r );
+  for ( size_t i = 0; i < results.size(); ++i ) nb_batch += results[ i ].size();
+  trace.endBlock();
+
+  size_t nb_knn = 0;
+  trace.beginBlock( "Batch 16-nearest queries" );
+  sub.kNearest( results, pts, 16 );
+  for ( size_t i = 0; i < results.size(); ++i ) nb_knn += results[ i ].size();
+  trace.endBlock();
+
+  trace.endBlock();
+  return nb_box == nb_radius && nb_radius == nb_batch && nb_knn == 16 * pts.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking SpatialCubicalSubdivision" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  for ( int radius = 32; radius <= 128; radius *= 2 )
+    res = res && benchmarkSphere( radius, 5 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
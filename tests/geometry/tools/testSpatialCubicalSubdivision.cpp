@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSpatialCubicalSubdivision.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class SpatialCubicalSubdivision.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SpatialCubicalSubdivision.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef SpatialCubicalSubdivision<Space> Subdivision;
+
+double squaredDistance( const Point& p, const Point& q )
+{
+  return ( p - q ).squaredNorm();
+}
+
+struct CloserTo {
+  Point c;
+  CloserTo( const Point& p ) : c( p ) {}
+  bool operator()( const Point& p, const Point& q ) const
+  { return squaredDistance( p, c ) < squaredDistance( q, c ); }
+};
+
+struct InsideBox {
+  Point lo, up;
+  InsideBox( const Point& l, const Point& u ) : lo( l ), up( u ) {}
+  bool operator()( const Point& p ) const
+  { return lo.isLower( p ) && p.isLower( up ); }
+};
+
+TEST_CASE( "Testing SpatialCubicalSubdivision" )
+{
+  const Point lo( -10, 0, 5 );
+  const Point up( 40, 25, 37 );
+  srand( 0 );
+  std::vector<Point> pts;
+  for ( int i = 0; i < 2000; ++i )
+    pts.push_back( Point( lo[ 0 ] + rand() % 51, lo[ 1 ] + rand() % 26, lo[ 2 ] + rand() % 33 ) );
+  pts.push_back( pts[ 0 ] ); // duplicate point
+
+  Subdivision sub( lo, up, 4 );
+  sub.push( pts.begin(), pts.begin() + 1000 );
+  sub.update();
+  sub.push( pts.begin() + 1000, pts.end() ); // pending points
+  REQUIRE( sub.size() == pts.size() );
+
+  std::vector<Point> queries;
+  queries.push_back( Point( 0, 0, 5 ) );
+  queries.push_back( Point( 13, 12, 20 ) );
+  queries.push_back( Point( 40, 25, 37 ) );
+  queries.push_back( Point( -30, 50, 20 ) ); // outside domain
+  queries.push_back( pts[ 0 ] );
+
+  SECTION( "Box queries return the points of the bins" )
+    {
+      const Point bin_lo( 1, 0, 2 );
+      const Point bin_up( 5, 3, 4 );
+      std::vector<Point> result;
+      sub.getPoints( result, bin_lo, bin_up );
+      InsideBox box( sub.lowest( bin_lo ), sub.uppermost( bin_up ) );
+      REQUIRE( (size_t) std::count_if( pts.begin(), pts.end(), box ) == result.size() );
+      REQUIRE( std::all_of( result.begin(), result.end(), box ) );
+
+      std::vector<Point> all;
+      sub.getPoints( all, sub.binDomain().lowerBound() - Point::diagonal( 2 ), sub.binDomain().upperBound() );
+      std::vector<Point> sorted_pts( pts );
+      std::sort( all.begin(), all.end() );
+      std::sort( sorted_pts.begin(), sorted_pts.end() );
+      REQUIRE( all == sorted_pts );
+    }
+
+  SECTION( "Radius queries are equal to brute force ones" )
+    {
+      for ( double radius = 0.0; radius < 12.0; radius += 2.7 )
+        for ( std::vector<Point>::const_iterator q = queries.begin(); q != queries.end(); ++q )
+          {
+            std::vector<Point> result, expected;
+            sub.radiusSearch( result, *q, radius );
+            for ( std::vector<Point>::const_iterator it = pts.begin(); it != pts.end(); ++it )
+              if ( squaredDistance( *it, *q ) <= radius * radius ) expected.push_back( *it );
+            std::sort( result.begin(), result.end() );
+            std::sort( expected.begin(), expected.end() );
+            REQUIRE( result == expected );
+          }
+      std::vector< std::vector<Point> > results;
+      sub.radiusSearch( results, queries, 6.5 );
+      REQUIRE( results.size() == queries.size() );
+      std::vector<Point> result;
+      sub.radiusSearch( result, queries[ 1 ], 6.5 );
+      REQUIRE( results[ 1 ] == result );
+    }
+
+  SECTION( "k-nearest queries are equal to brute force ones" )
+    {
+      const Subdivision::Size ks[] = { 1, 7, 50, 3000 };
+      for ( int i = 0; i < 4; ++i )
+        for ( std::vector<Point>::const_iterator q = queries.begin(); q != queries.end(); ++q )
+          {
+            std::vector<Point> result;
+            sub.kNearest( result, *q, ks[ i ] );
+            std::vector<Point> expected( pts );
+            std::stable_sort( expected.begin(), expected.end(), CloserTo( *q ) );
+            expected.resize( std::min( (size_t) ks[ i ], expected.size() ) );
+            REQUIRE( result.size() == expected.size() );
+            for ( size_t j = 0; j < result.size(); ++j )
+              REQUIRE( squaredDistance( result[ j ], *q ) == squaredDistance( expected[ j ], *q ) );
+          }
+      std::vector< std::vector<Point> > results;
+      sub.kNearest( results, queries, 10 );
+      REQUIRE( results.size() == queries.size() );
+      std::vector<Point> result;
+      sub.kNearest( result, queries[ 2 ], 10 );
+      REQUIRE( results[ 2 ] == result );
+    }
+
+  SECTION( "Copies are independent" )
+    {
+      Subdivision copy( sub );
+      copy.push( pts[ 1 ] );
+      REQUIRE( copy.size() == sub.size() + 1 );
+      std::vector<Point> result;
+      copy.radiusSearch( result, pts[ 1 ], 0.0 );
+      REQUIRE( result.size() >= 2 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -653,6 +653,57 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Extension of a narrow band compared with a single computation
+ *
+ */
+bool testExtendBand(int size)
+{
+
+  static const DGtal::Dimension dimension = 2; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+  DomainPredicate<Domain> dp(d);
+
+  //Images and sets, from two seeds
+  typedef ImageContainerBySTLMap<Domain,double> Image; 
+  typedef DigitalSetFromMap<Image> Set; 
+  typedef FMM<Image, Set, DomainPredicate<Domain> > FMM; 
+  Image map1( d, 0.0 ), map2( d, 0.0 ); 
+  Set set1( map1 ), set2( map2 ); 
+  std::vector<Point> seeds; 
+  seeds.push_back( Point( -5, 3 ) ); 
+  seeds.push_back( Point( 7, -2 ) ); 
+  FMM::initFromPointsRange( seeds.begin(), seeds.end(), map1, set1, 0.0 ); 
+  FMM::initFromPointsRange( seeds.begin(), seeds.end(), map2, set2, 0.0 ); 
+
+  trace.beginBlock ( "Extending a band " );
+  FMM fmm1( map1, set1, dp, d.size() + 1, size / 4.0 ); 
+  fmm1.compute(); 
+  const unsigned int area1 = set1.size(); 
+  trace.info() << fmm1 << std::endl; 
+  fmm1.extendBand( size / 2.0 ); 
+  trace.info() << fmm1 << std::endl; 
+
+  FMM fmm2( map2, set2, dp, d.size() + 1, size / 2.0 ); 
+  fmm2.compute(); 
+  trace.info() << fmm2 << std::endl; 
+  trace.endBlock();
+
+  bool flagIsOk = ( area1 < set1.size() ) && ( set1.size() == set2.size() ) 
+    && ( fmm1.valueThreshold() == size / 2.0 ); 
+  for (Set::ConstIterator it = set2.begin(), itEnd = set2.end(); 
+       ( (it != itEnd)&&(flagIsOk) ); ++it)
+    {
+      if ( ( set1.find( *it ) == set1.end() ) || ( map1( *it ) != map2( *it ) ) )
+	flagIsOk = false; 
+    }
+  return flagIsOk && fmm1.isValid(); 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -673,6 +724,7 @@ int main ( int argc, char** argv )
     && testDisplayDT2d( size, 2*area, std::sqrt(2*size*size) )
     && testDisplayDTFromCircle(size)   
     && accuracyTest(size)
+    && testExtendBand(size)
     ;
 
   size = 25;
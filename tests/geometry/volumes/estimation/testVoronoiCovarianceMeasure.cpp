@@ -96,6 +96,36 @@ bool testVoronoiCovarianceMeasure()
   trace.info() << "(" << nbok << "/" << nb << ") "
                << "sizeCells.size() == 10" << std::endl;
 
+  // Checks contiguous VCM against a sequential accumulation.
+  std::map<Point,Matrix> refVCM;
+  for ( Domain::ConstIterator it = d.begin(), itE = d.end(); it != itE; ++it )
+    {
+      Point q = vcm.voronoiMap()( *it );
+      if ( q == *it || l2( q, *it ) > vcm.R() ) continue;
+      VCM::VectorN v = *it - q;
+      Matrix m;
+      for ( Dimension i = 0; i < 3; ++i )
+        for ( Dimension j = 0; j < 3; ++j )
+          m.setComponent( i, j, v[ i ] * v[ j ] );
+      refVCM[ q ] += m;
+    }
+  bool sameVCM = vcm.points().size() == 9 && vcm.vcmVector().size() == 9;
+  for ( unsigned int i = 0; i < vcm.points().size(); ++i )
+    {
+      Point p = vcm.points()[ i ];
+      sameVCM = sameVCM && vcm.index( p ) == (VCM::Index) i
+        && refVCM[ p ] == vcm.vcmVector()[ i ]
+        && vcm.vcmMap().find( p )->second == vcm.vcmVector()[ i ];
+    }
+  nbok += sameVCM ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcmVector() == sequential VCM" << std::endl;
+  nbok += vcm.index( Point( 0, 0, 0 ) ) == -1 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "index( (0,0,0) ) == -1" << std::endl;
+
   functors::HatPointFunction< Point, double > chi_r( 1.0, 4.0 );
   Matrix vcm_r = vcm.measure( chi_r, Point( 10,10,10 ) );
   trace.info() << "- vcm_r.row(0) = " << vcm_r.row( 0 ) << std::endl;
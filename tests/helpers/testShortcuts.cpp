@@ -29,6 +29,14 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdio>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include <iterator>
+#include <algorithm>
+#include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/Shortcuts.h"
 #include "DGtalCatch.h"
@@ -42,20 +50,44 @@ using namespace DGtal;
 // Functions for testing class Shortcuts.
 ///////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+  typedef Shortcuts< KhalimskySpaceND<3> > SH3;
+
+  /// The digitization of the "goursat" polynomial, with its space and
+  /// its boundary, as used by most scenarios below. It is not
+  /// copyable since the surface refers to the space K.
+  struct Goursat
+  {
+    CountedPtr< SH3::BinaryImage >         binary_image;
+    SH3::KSpace                            K;
+    CountedPtr< SH3::LightDigitalSurface > surface;
+
+    /// @param[in,out] params the parameters of the shortcuts, where the
+    /// polynomial and the grid step \a h are set.
+    /// @param[in] h the grid step.
+    Goursat( Parameters& params, double h )
+    {
+      params( "polynomial", "goursat" )( "gridstep", h );
+      auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+      auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+      binary_image         = SH3::makeBinaryImage      ( digitized_shape, params );
+      K                    = SH3::getKSpace( params );
+      surface              = SH3::makeLightDigitalSurface( binary_image, K, params );
+    }
+    Goursat( const Goursat& ) = delete;
+    Goursat& operator=( const Goursat& ) = delete;
+  };
+}
+
 SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
 {
   typedef KhalimskySpaceND<3>                       KSpace;
   typedef Shortcuts< KSpace >                       SH3;
 
   auto params          = SH3::defaultParameters();
-  const double h       = 0.25;
-  params( "polynomial", "goursat" )( "gridstep", h );
-  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
-  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
-  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
-  auto K               = SH3::getKSpace( params );
-  auto embedder        = SH3::getCellEmbedder( K );
-  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  const Goursat goursat( params, 0.25 );
+  auto surface         = goursat.surface;
   
   GIVEN( "A digital surface, its associated polygonal surface, and its pointel range" ) {
     SH3::Cell2Index c2i;
@@ -82,5 +114,355 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > binary images", "[shortcuts][binary_image]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+  const auto domain    = binary_image->domain();
+
+  GIVEN( "A binary image digitizing an implicit shape" ) {
+    THEN( "It has the same values as the digitized shape" ) {
+      unsigned int nb_ok = 0, nb_in = 0;
+      for ( auto p : domain )
+        {
+          nb_ok += (*binary_image)( p ) == (*digitized_shape)( p ) ? 1 : 0;
+          nb_in += (*digitized_shape)( p ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == domain.size() );
+      REQUIRE( binary_image->count() == nb_in );
+    }
+    THEN( "Its gray-scale image has the same values" ) {
+      auto gray_image = SH3::makeGrayScaleImage( binary_image );
+      unsigned int nb_ok = 0;
+      for ( auto p : domain )
+        nb_ok += ( (*gray_image)( p ) != 0 ) == (*binary_image)( p ) ? 1 : 0;
+      REQUIRE( nb_ok == domain.size() );
+    }
+    THEN( "Kanungo noise changes some values, mostly near the boundary" ) {
+      params( "noise", 0.3 );
+      auto noisy_image = SH3::makeBinaryImage( binary_image, params );
+      SH3::BinaryImage diff( *noisy_image );
+      diff ^= *binary_image;
+      REQUIRE( diff.count() > 0 );
+      REQUIRE( diff.count() < binary_image->count() );
+    }
+  }
+}
+
+SCENARIO( "Shortcuts< K3 > surfel chunks", "[shortcuts][chunks]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  params( "chunkSize", 100 );
+  const Goursat goursat( params, 0.5 );
+  auto surface         = goursat.surface;
+
+  GIVEN( "A light digital surface traversed by chunks" ) {
+    const std::string traversals[] = { "Default", "DepthFirst", "BreadthFirst" };
+    for ( auto&& traversal : traversals )
+      {
+        params( "surfaceTraversal", traversal );
+        auto surfels = SH3::getSurfelRange( surface, params );
+        SH3::SurfelRange chunked;
+        unsigned int nb_big = 0, nb_chunks = 0;
+        auto nb = SH3::traverseSurfelChunks( surface, [&] ( const SH3::SurfelRange& chunk )
+          {
+            nb_big    += chunk.size() > 100 ? 1 : 0;
+            nb_chunks += 1;
+            chunked.insert( chunked.end(), chunk.begin(), chunk.end() );
+          }, params );
+        THEN( "The chunks give the surfels of the traversal, in the same order" ) {
+          REQUIRE( nb == surfels.size() );
+          REQUIRE( chunked == surfels );
+          REQUIRE( nb_big == 0 );
+          REQUIRE( nb_chunks == ( surfels.size() + 99 ) / 100 );
+        }
+      }
+  }
+}
+
+SCENARIO( "Shortcuts< K3 > space-filling curve orders", "[shortcuts][order]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  GIVEN( "The spels of a box" ) {
+    KSpace K;
+    K.init( SH3::Point( 0, 0, 0 ), SH3::Point( 7, 7, 7 ), true );
+    SH3::SurfelRange spels;
+    for ( auto p : SH3::Domain( K.lowerBound(), K.upperBound() ) )
+      spels.push_back( K.sSpel( p ) );
+    THEN( "Successive spels along the Hilbert curve are adjacent" ) {
+      auto perm = SH3::getSurfelPermutation( K, spels, "Hilbert" );
+      unsigned int nb_ok = 0;
+      for ( std::size_t i = 1; i < perm.size(); ++i )
+        nb_ok += ( K.sCoords( spels[ perm[ i ] ] )
+                   - K.sCoords( spels[ perm[ i - 1 ] ] ) ).norm1() == 1 ? 1 : 0;
+      REQUIRE( perm.size() == spels.size() );
+      REQUIRE( nb_ok == perm.size() - 1 );
+    }
+    THEN( "Successive groups of 8 spels along the Morton curve are cubes" ) {
+      auto perm = SH3::getSurfelPermutation( K, spels, "Morton" );
+      unsigned int nb_ok = 0;
+      for ( std::size_t i = 0; i < perm.size(); i += 8 )
+        {
+          SH3::Point lo = K.sCoords( spels[ perm[ i ] ] );
+          SH3::Point up = lo;
+          for ( std::size_t j = i + 1; j < i + 8; ++j )
+            {
+              lo = lo.inf( K.sCoords( spels[ perm[ j ] ] ) );
+              up = up.sup( K.sCoords( spels[ perm[ j ] ] ) );
+            }
+          nb_ok += ( up - lo == SH3::Point::diagonal( 1 ) ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == perm.size() / 8 );
+    }
+  }
+
+  auto params          = SH3::defaultParameters();
+  const Goursat goursat( params, 0.5 );
+  auto K               = goursat.K;
+  auto surface         = goursat.surface;
+  auto surfels         = SH3::getSurfelRange( surface, params );
+
+  GIVEN( "The surfels of a surface sorted along a curve" ) {
+    const std::string curves[] = { "Morton", "Hilbert" };
+    for ( auto&& curve : curves )
+      {
+        auto perm   = SH3::getSurfelPermutation( K, surfels, curve );
+        auto sorted = SH3::getSurfelRange( surface, Parameters( "surfaceTraversal", curve ) );
+        THEN( "The traversal gives the permuted surfels, which can be put back in order" ) {
+          std::vector< bool > seen( perm.size(), false );
+          for ( auto i : perm ) seen[ i ] = true;
+          REQUIRE( std::count( seen.begin(), seen.end(), true ) == (int) surfels.size() );
+          REQUIRE( sorted == SH3::getPermutedRange( surfels, perm ) );
+          REQUIRE( SH3::getUnpermutedRange( sorted, perm ) == surfels );
+        }
+        THEN( "The vertices of an indexed surface may be numbered along the curve" ) {
+          const SH3::SurfelSet surfel_set( surfels.begin(), surfels.end() );
+          auto idx_surface = SH3::makeIdxDigitalSurface
+            ( surfel_set, K, params( "vertexOrder", curve ) );
+          REQUIRE( idx_surface->nbVertices() == sorted.size() );
+          unsigned int nb_ok = 0;
+          for ( std::size_t i = 0; i < sorted.size(); ++i )
+            nb_ok += ( idx_surface->surfel( i ) == sorted[ i ] ) ? 1 : 0;
+          REQUIRE( nb_ok == sorted.size() );
+          auto idx_sorted = SH3::getIdxSurfelRange
+            ( idx_surface, Parameters( "surfaceTraversal", curve ) );
+          REQUIRE( idx_sorted == idx_surface->allVertices() );
+          REQUIRE( idx_surface->degree( 0 ) == 4 );
+        }
+      }
+  }
+}
+
+SCENARIO( "Shortcuts< K3 > cache of indexed surfaces", "[shortcuts][cache]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  const Goursat goursat( params, 0.5 );
+  auto binary_image    = goursat.binary_image;
+  auto K               = goursat.K;
+  const std::string filename = params[ "cacheDirectory" ].as<std::string>() + "/"
+    + SH3::getCacheKey( binary_image, K, params, "IdxDigitalSurface" ) + ".surfels";
+  std::remove( filename.c_str() );
+
+  GIVEN( "An indexed digital surface built through the cache" ) {
+    auto surface  = SH3::makeCachedIdxDigitalSurface( binary_image, K, params );
+    auto expected = SH3::makeIdxDigitalSurface( binary_image, K, params );
+    THEN( "It is the same as the one built without the cache" ) {
+      REQUIRE( surface->nbVertices() == expected->nbVertices() );
+      REQUIRE( surface->nbFaces()    == expected->nbFaces() );
+    }
+    THEN( "Its surfels are written into the cache, and read back in the same order" ) {
+      SH3::SurfelRange surfels;
+      REQUIRE( SH3::loadCachedSurfels( surfels, K, filename ) );
+      REQUIRE( surfels.size() == surface->nbVertices() );
+      auto cached  = SH3::makeCachedIdxDigitalSurface( binary_image, K, params );
+      auto s2i     = surface->surfels();
+      auto c2i     = cached->surfels();
+      unsigned int nb_ok = 0;
+      for ( SH3::Idx i = 0; i < surfels.size(); ++i )
+        nb_ok += ( surfels[ i ] == s2i[ i ] && c2i[ i ] == s2i[ i ] ) ? 1 : 0;
+      REQUIRE( nb_ok == surfels.size() );
+      REQUIRE( cached->nbFaces() == surface->nbFaces() );
+    }
+    THEN( "Another image does not give the same key" ) {
+      SH3::BinaryImage other( *binary_image );
+      other.setValue( other.domain().lowerBound(), ! other( other.domain().lowerBound() ) );
+      REQUIRE( SH3::getCacheKey( CountedPtr< SH3::BinaryImage >( new SH3::BinaryImage( other ) ),
+                                 params, "IdxDigitalSurface" )
+               != SH3::getCacheKey( binary_image, params, "IdxDigitalSurface" ) );
+    }
+    THEN( "Another space does not give the same key" ) {
+      KSpace open_K, big_K;
+      REQUIRE( open_K.init( K.lowerBound(), K.upperBound(), false ) );
+      REQUIRE( big_K.init( K.lowerBound(), K.upperBound() + SH3::Point::diagonal( 1 ), true ) );
+      const std::string key = SH3::getCacheKey( binary_image, K, params, "IdxDigitalSurface" );
+      REQUIRE( SH3::getCacheKey( binary_image, open_K, params, "IdxDigitalSurface" ) != key );
+      REQUIRE( SH3::getCacheKey( binary_image, big_K, params, "IdxDigitalSurface" ) != key );
+    }
+    THEN( "Cached surfels outside the space are not read" ) {
+      KSpace small_K;
+      REQUIRE( small_K.init( SH3::Point::diagonal( -1 ), SH3::Point::diagonal( 1 ), true ) );
+      SH3::SurfelRange surfels;
+      REQUIRE( ! SH3::loadCachedSurfels( surfels, small_K, filename ) );
+    }
+    THEN( "Invalid cache files are not read" ) {
+      SH3::Scalars values;
+      REQUIRE( ! SH3::loadCachedScalars( values, filename ) );
+      REQUIRE( ! SH3::loadCachedScalars( values, filename + ".missing" ) );
+    }
+    THEN( "Truncated or corrupted cache files are cache misses" ) {
+      const std::string scalars_file = "testShortcuts-cache.scalars";
+      SH3::Scalars values( 1000, 0.5 ), read;
+      REQUIRE( SH3::saveCachedScalars( values, scalars_file ) );
+      REQUIRE( SH3::loadCachedScalars( read, scalars_file ) );
+      REQUIRE( read == values );
+      std::string bytes;
+      {
+        std::ifstream input( scalars_file.c_str(), std::ios::binary );
+        bytes.assign( std::istreambuf_iterator<char>( input ),
+                      std::istreambuf_iterator<char>() );
+      }
+      // Truncated file.
+      {
+        std::ofstream output( scalars_file.c_str(), std::ios::binary );
+        output.write( bytes.data(), bytes.size() / 2 );
+      }
+      REQUIRE( ! SH3::loadCachedScalars( read, scalars_file ) );
+      // Huge count in the header (its last 8 bytes).
+      {
+        std::string corrupted = bytes;
+        for ( std::size_t i = 16; i < 24; ++i ) corrupted[ i ] = (char) 0x7f;
+        std::ofstream output( scalars_file.c_str(), std::ios::binary );
+        output.write( corrupted.data(), corrupted.size() );
+      }
+      REQUIRE( ! SH3::loadCachedScalars( read, scalars_file ) );
+      std::remove( scalars_file.c_str() );
+    }
+    std::remove( filename.c_str() );
+  }
+}
+
+SCENARIO( "Shortcuts< K3 > field outputs", "[shortcuts][output]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  const Goursat goursat( params, 0.5 );
+  auto K               = goursat.K;
+  auto surface         = goursat.surface;
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  SH3::Scalars     values;
+  SH3::RealVectors vectors;
+  std::map< SH3::SCell, double > values_map;
+  for ( auto&& s : surfels )
+    {
+      const auto p = K.sKCoords( s );
+      values.push_back( 0.1 * p[ 0 ] - p[ 1 ] / 3.0 + 1e-7 * p[ 2 ] );
+      vectors.push_back( SH3::RealVector( p[ 0 ], 0.5 * p[ 1 ], -0.25 * p[ 2 ] ) );
+      values_map[ s ] = values.back();
+    }
+
+  GIVEN( "A field of scalars on a surface of several thousands of surfels" ) {
+    THEN( "Its CSV output is the same as the one formatted by a stream" ) {
+      std::ostringstream output, expected;
+      REQUIRE( SH3::outputSCellMapAsCSV( output, K, values_map, SH3::ValueWriter<double>() ) );
+      for ( auto&& v : values_map )
+        {
+          for ( Dimension d = 0; d < 3; ++d )
+            expected << " " << K.sKCoord( v.first, d );
+          expected << " " << K.sSign( v.first ) << " " << v.second << std::endl;
+        }
+      REQUIRE( surfels.size() > 4096 );
+      REQUIRE( output.str() == expected.str() );
+    }
+    THEN( "Its CSV output accepts value writers working on std::ostream" ) {
+      struct StreamWriter {
+        void operator()( std::ostream& output, const double& v ) const
+        { output << " " << std::setprecision( 3 ) << v; }
+      };
+      std::ostringstream output, expected;
+      REQUIRE( SH3::outputSCellMapAsCSV( output, K, values_map, StreamWriter() ) );
+      for ( auto&& v : values_map )
+        {
+          for ( Dimension d = 0; d < 3; ++d )
+            expected << " " << K.sKCoord( v.first, d );
+          expected << " " << K.sSign( v.first ) << " "
+                   << std::setprecision( 3 ) << v.second << std::endl;
+        }
+      REQUIRE( output.str() == expected.str() );
+    }
+    THEN( "Its OBJ output has one line per vertex and per face" ) {
+      std::ostringstream output;
+      REQUIRE( SH3::outputSurfelsAsObj( output, surfels, SH3::getCellEmbedder( K ) ) );
+      std::istringstream input( output.str() );
+      std::string line;
+      unsigned int nb_v = 0, nb_f = 0;
+      while ( std::getline( input, line ) )
+        {
+          nb_v += line[ 0 ] == 'v' ? 1 : 0;
+          nb_f += line[ 0 ] == 'f' ? 1 : 0;
+        }
+      REQUIRE( nb_f == surfels.size() );
+      REQUIRE( nb_v == SH3::getPointelRange( surface ).size() );
+    }
+    THEN( "Its binary output is read back" ) {
+      std::map< std::string, SH3::Scalars >     scalar_fields;
+      std::map< std::string, SH3::RealVectors > vector_fields;
+      scalar_fields[ "H" ] = values;
+      vector_fields[ "N" ] = vectors;
+      REQUIRE( SH3::saveBinaryFields( "testShortcuts-fields.json", surfels, scalar_fields, vector_fields ) );
+      std::ifstream json( "testShortcuts-fields.json" );
+      std::string text( ( std::istreambuf_iterator<char>( json ) ),
+                        std::istreambuf_iterator<char>() );
+      REQUIRE( text.find( "\"count\": " + std::to_string( surfels.size() ) ) != std::string::npos );
+      REQUIRE( text.find( "\"file\": \"testShortcuts-fields.N.bin\", \"type\": \"float64\", \"components\": 3" )
+               != std::string::npos );
+      std::ifstream hfile( "testShortcuts-fields.H.bin", std::ios::binary );
+      std::vector< double > h( values.size() + 1 );
+      hfile.read( (char*) h.data(), h.size() * sizeof( double ) );
+      REQUIRE( hfile.gcount() == (std::streamsize) ( values.size() * sizeof( double ) ) );
+      h.pop_back();
+      REQUIRE( h == values );
+      std::ifstream sfile( "testShortcuts-fields.surfels.bin", std::ios::binary );
+      std::vector< SH3::Integer > c( 4 * surfels.size() );
+      sfile.read( (char*) c.data(), c.size() * sizeof( SH3::Integer ) );
+      unsigned int nb_ok = 0;
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        nb_ok += ( K.sCell( SH3::Point( c[ 4*i ], c[ 4*i+1 ], c[ 4*i+2 ] ),
+                            c[ 4*i+3 ] ? K.POS : K.NEG ) == surfels[ i ] ) ? 1 : 0;
+      REQUIRE( nb_ok == surfels.size() );
+      std::remove( "testShortcuts-fields.json" );
+      std::remove( "testShortcuts-fields.surfels.bin" );
+      std::remove( "testShortcuts-fields.H.bin" );
+      std::remove( "testShortcuts-fields.N.bin" );
+    }
+    THEN( "Array files are named after the JSON file even in a dotted directory" ) {
+      std::map< std::string, SH3::Scalars > scalar_fields;
+      scalar_fields[ "H" ] = values;
+      REQUIRE( SH3::saveBinaryFields( "./testShortcuts-dotted-fields", SH3::SurfelRange(), scalar_fields ) );
+      std::ifstream json( "./testShortcuts-dotted-fields.json" );
+      std::ifstream hfile( "./testShortcuts-dotted-fields.H.bin", std::ios::binary );
+      REQUIRE( json.good() );
+      REQUIRE( hfile.good() );
+      std::remove( "./testShortcuts-dotted-fields.json" );
+      std::remove( "./testShortcuts-dotted-fields.H.bin" );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedBinaryImage.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PackedBinaryImage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/PackedBinaryImage.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedBinaryImage.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PackedBinaryImage" )
+{
+  typedef PackedBinaryImage<Z3i::Domain>                 BinaryImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool>   BoolImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< BinaryImage > ));
+
+  // 70 is not a multiple of 64, so that rows have a partial last word.
+  Z3i::Domain domain( Z3i::Point( -5, -3, 2 ), Z3i::Point( 64, 7, 9 ) );
+  auto ball = [] ( const Z3i::Point& p )
+    { return ( p - Z3i::Point( 30, 2, 5 ) ).norm() <= 6.5; };
+  auto slab = [] ( const Z3i::Point& p )
+    { return ( p[ 0 ] + p[ 1 ] ) % 3 == 0; };
+
+  SECTION( "Reading and writing values" )
+    {
+      BinaryImage image( domain );
+      REQUIRE( image.isValid() );
+      REQUIRE( image.nbRows() == 11 * 8 );
+      REQUIRE( image.nbWordsPerRow() == 2 );
+      REQUIRE( image.count() == 0 );
+      BoolImage ref( domain );
+      for ( auto p : domain )
+        {
+          image.setValue( p, ball( p ) );
+          ref.setValue( p, ball( p ) );
+        }
+      unsigned int nbok = 0;
+      for ( auto p : domain )
+        nbok += image( p ) == ref( p ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+      REQUIRE( std::equal( image.constRange().begin(), image.constRange().end(),
+                           ref.begin() ) );
+      REQUIRE( image.count() == std::count( ref.begin(), ref.end(), true ) );
+      BinaryImage full( domain, true );
+      REQUIRE( full.isValid() );
+      REQUIRE( full.count() == domain.size() );
+    }
+
+  SECTION( "Parallel writers" )
+    {
+      BinaryImage image( domain );
+      image.assign( ball );
+      BinaryImage image2( domain );
+      const std::ptrdiff_t nb = domain.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static,7)
+#endif
+      for ( std::ptrdiff_t i = 0; i < nb; ++i )
+        {
+          Z3i::Point p = domain.lowerBound()
+            + Z3i::Point( i % 70, ( i / 70 ) % 11, i / ( 70 * 11 ) );
+          image2.setValueAtomic( p, ball( p ) );
+        }
+      REQUIRE( image.isValid() );
+      unsigned int nbok = 0;
+      for ( auto p : domain )
+        nbok += ( image( p ) == ball( p ) && image2( p ) == ball( p ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+      REQUIRE( image.words() == image2.words() );
+    }
+
+  SECTION( "Boolean operations" )
+    {
+      BinaryImage A( domain ), B( domain );
+      A.assign( ball );
+      B.assign( slab );
+      BinaryImage U( A ), I( A ), X( A ), D( A ), C( A );
+      U |= B; I &= B; X ^= B; D -= B; C.complement();
+      REQUIRE( C.isValid() );
+      unsigned int nbok = 0;
+      for ( auto p : domain )
+        {
+          const bool a = ball( p ), b = slab( p );
+          nbok += ( U( p ) == ( a || b ) ) && ( I( p ) == ( a && b ) )
+            && ( X( p ) == ( a != b ) ) && ( D( p ) == ( a && ! b ) )
+            && ( C( p ) == ! a ) ? 1 : 0;
+        }
+      REQUIRE( nbok == domain.size() );
+      REQUIRE( C.count() + A.count() == domain.size() );
+      REQUIRE( U.count() + I.count() == A.count() + B.count() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -32,7 +32,11 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/writers/MeshWriter.h"
+#include "DGtal/io/BufferedStreams.h"
 #include "DGtal/helpers/StdDefs.h"
+#include <fstream>
+#include <sstream>
 
 #include "ConfigTest.h"
 
@@ -129,6 +133,145 @@ bool testMeshReader()
   return nbok == nb;
 }
 
+/**
+ * Checks that BufferedStreamWriter formats numbers like std::ostream
+ * and that BufferedStreamReader reads them back.
+ */
+bool testBufferedStreams()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing BufferedStreamWriter and BufferedStreamReader" );
+  const double reals[] = { 0.0, -0.0, 1.0, -2.0, 0.5, 1.0/3.0, -1e-7, 123456.0, 1234567.0,
+                           1e22, 6.02214076e23, -4.9e-324, 3.14159265358979 };
+  const long long integers[] = { 0, 7, -7, 1234567890123LL, -9223372036854775807LL };
+  for ( int precision = 6; precision <= 17; precision += 11 )
+    {
+      std::ostringstream expected, obtained;
+      expected.precision( precision );
+      obtained.precision( precision );
+      {
+        BufferedStreamWriter writer( obtained );
+        for ( double x : reals )
+          {
+            expected << x << ' ';
+            writer   << x << ' ';
+          }
+        for ( long long i : integers )
+          {
+            expected << i << '\n';
+            writer   << i << '\n';
+          }
+      }
+      nb++;
+      nbok += expected.str() == obtained.str() ? 1 : 0;
+
+      std::istringstream input( obtained.str() );
+      BufferedStreamReader reader( input );
+      bool same = true;
+      for ( double x : reals )
+        {
+          double y;
+          same = same && reader.read( y )
+            && ( precision < 17 || y == x );
+        }
+      for ( long long i : integers )
+        {
+          long long j;
+          same = same && reader.read( j ) && i == j;
+        }
+      nb++;
+      nbok += same && reader.good() ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "precision " << precision << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Writes a mesh in each format and reads it back.
+ */
+bool testMeshRoundTrip()
+{
+  typedef Z3i::RealPoint RealPoint;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing export/import round trips" );
+  Mesh<RealPoint> aMesh( true );
+  for ( unsigned int i = 0; i < 8; ++i )
+    aMesh.addVertex( RealPoint( ( i & 1 ) / 3.0, ( i & 2 ) * 1.25, ( i & 4 ) * -0.1 ) );
+  aMesh.addQuadFace( 0, 1, 3, 2, Color( 250, 0, 0, 200 ) );
+  aMesh.addQuadFace( 4, 6, 7, 5, Color( 250, 250, 0 ) );
+  aMesh.addTriangularFace( 0, 4, 5, Color( 0, 0, 255 ) );
+
+  struct Test { std::string filename; bool binary; bool exact; bool color; };
+  const Test tests[] = { { "testMeshRoundTrip.ply", true,  true, true },
+                         { "testMeshRoundTripAscii.ply", false, true, true },
+                         { "testMeshRoundTrip.off", false, true, false },
+                         { "testMeshRoundTrip.obj", false, true, false } };
+  for ( const Test & test : tests )
+    {
+      {
+        std::ofstream out( test.filename.c_str(), std::ofstream::out | std::ofstream::binary );
+        out.precision( 17 );
+        const std::string ext = test.filename.substr( test.filename.size() - 3 );
+        if ( ext == "ply" )      MeshWriter<RealPoint>::export2PLY( out, aMesh, test.binary );
+        else if ( ext == "off" ) MeshWriter<RealPoint>::export2OFF( out, aMesh );
+        else                     MeshWriter<RealPoint>::export2OBJ( out, aMesh );
+      }
+      Mesh<RealPoint> readMesh( true );
+      bool ok = readMesh << test.filename;
+      ok = ok && readMesh.nbVertex() == aMesh.nbVertex()
+        && readMesh.nbFaces() == aMesh.nbFaces();
+      for ( unsigned int i = 0; ok && i < aMesh.nbVertex(); ++i )
+        ok = readMesh.getVertex( i ) == aMesh.getVertex( i );
+      for ( unsigned int i = 0; ok && i < aMesh.nbFaces(); ++i )
+        ok = readMesh.getFace( i ) == aMesh.getFace( i )
+          && ( ! test.color || readMesh.getFaceColor( i ) == aMesh.getFaceColor( i ) );
+      nb++;
+      nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << test.filename << std::endl;
+    }
+
+  // Reversing faces on import.
+  Mesh<RealPoint> invertedMesh;
+  MeshReader<RealPoint>::importPLYFile( "testMeshRoundTrip.ply", invertedMesh, true );
+  Mesh<RealPoint>::MeshFace aFace = aMesh.getFace( 2 );
+  std::reverse( aFace.begin(), aFace.end() );
+  nb++;
+  nbok += invertedMesh.getFace( 2 ) == aFace ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "inverted faces" << std::endl;
+
+  // Face indices out of the range of the vertices are rejected.
+  const std::string badIndices[] = { "3", "-1", "1.5" };
+  for ( const std::string & index : badIndices )
+    {
+      {
+        std::ofstream out( "testMeshBadIndex.ply" );
+        out << "ply\nformat ascii 1.0\nelement vertex 3\n"
+            << "property float x\nproperty float y\nproperty float z\n"
+            << "element face 1\nproperty list uchar int vertex_indices\n"
+            << "end_header\n0 0 0\n1 0 0\n0 1 0\n3 0 1 " << index << "\n";
+      }
+      Mesh<RealPoint> badMesh;
+      bool hasThrown = false;
+      try {
+        MeshReader<RealPoint>::importPLYFile( "testMeshBadIndex.ply", badMesh );
+      } catch ( IOException & ) {
+        hasThrown = true;
+      }
+      nb++;
+      nbok += hasThrown ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "invalid face index " << index << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -140,7 +283,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshReader(); // && ... other tests
+  bool res = testMeshReader() && testBufferedStreams()
+    && testMeshRoundTrip(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,114 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPointListReader-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of PointListReader on text and binary point lists,
+ * compared with line by line std::istringstream parsing.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/readers/PointListReader.h"
+#include "DGtal/io/writers/PointListWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class PointListReader.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef Z3i::RealPoint RealPoint;
+
+/// Reads points line by line with std::istringstream, as done before.
+std::vector<RealPoint> readWithIstringstream( const std::string & filename )
+{
+  std::vector<RealPoint> points;
+  std::ifstream in( filename.c_str() );
+  std::string str;
+  while ( std::getline( in, str ) )
+    {
+      if ( str.empty() || str[ 0 ] == '#' ) continue;
+      std::istringstream in_str( str );
+      RealPoint p;
+      if ( in_str >> p[ 0 ] >> p[ 1 ] >> p[ 2 ] )
+        points.push_back( p );
+    }
+  return points;
+}
+
+bool benchmarkPointList( unsigned int n )
+{
+  trace.beginBlock( "Benchmarking " + std::to_string( n ) + " points" );
+  std::vector<RealPoint> points( n );
+  for ( unsigned int i = 0; i < n; ++i )
+    points[ i ] = RealPoint( cos( 0.001 * i ) * i, sin( 0.001 * i ) * i, 0.5 * i );
+
+  trace.beginBlock( "Text export with PointListWriter" );
+  PointListWriter<RealPoint>::exportToFile( "benchmark-points.pl", points );
+  trace.endBlock();
+
+  trace.beginBlock( "Binary export with PointListWriter" );
+  PointListWriter<RealPoint>::exportToBinaryFile( "benchmark-points.bin", points );
+  trace.endBlock();
+
+  trace.beginBlock( "Text import with std::istringstream" );
+  const std::vector<RealPoint> pointsRef = readWithIstringstream( "benchmark-points.pl" );
+  trace.endBlock();
+
+  trace.beginBlock( "Text import with PointListReader" );
+  const std::vector<RealPoint> pointsText = PointListReader<RealPoint>::getPointsFromFile( "benchmark-points.pl" );
+  trace.endBlock();
+
+  trace.beginBlock( "Binary import with PointListReader" );
+  const std::vector<RealPoint> pointsBinary = PointListReader<RealPoint>::getPointsFromBinaryFile( "benchmark-points.bin" );
+  trace.endBlock();
+
+  trace.endBlock();
+  return pointsText == pointsRef && pointsBinary == points;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking PointListReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  for ( unsigned int n = 100000; n <= 1600000; n *= 4 )
+    res = res && benchmarkPointList( n );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -31,7 +31,13 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/io/readers/PointListReader.h"
+#include "DGtal/io/writers/PointListWriter.h"
 #include "DGtal/helpers/StdDefs.h"
+#include <sstream>
+#include <fstream>
+#include <cstring>
+#include <iterator>
+#include <string>
 #include "DGtal/geometry/curves/FreemanChain.h" 
 
 #include "ConfigTest.h"
@@ -119,6 +125,114 @@ bool testPointListReader()
   return nbok == nb;
 }
 
+/**
+ * Reads a large point list (split in several chunks) and checks it
+ * against the generated points.
+ */
+bool testLargePointList()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing reading a large point list ..." );
+  std::vector<Z3i::RealPoint> expected;
+  std::ostringstream text;
+  text.precision( 17 );
+  for ( int i = 0; i < 100000; ++i )
+    {
+      if ( i % 1000 == 0 ) text << "# comment " << i << "\n\n";
+      const Z3i::RealPoint p( i / 7.0, -i * 0.25, i );
+      expected.push_back( p );
+      text << p[ 0 ] << " " << p[ 1 ] << "\t" << p[ 2 ] << ( i % 2 ? " extra\r\n" : "\n" );
+    }
+  text << "1 2"; // incomplete point without newline
+  text << "\n4 5 6"; // last line without newline
+  expected.push_back( Z3i::RealPoint( 4, 5, 6 ) );
+
+  std::istringstream in( text.str() );
+  std::vector<Z3i::RealPoint> points = PointListReader<Z3i::RealPoint>::getPointsFromInputStream( in );
+  nbok += points == expected ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << points.size() << " points" << std::endl;
+
+  std::vector<unsigned int> vectPos;
+  vectPos.push_back( 2 );
+  vectPos.push_back( 0 );
+  std::istringstream in2( text.str() );
+  std::vector<Z2i::Point> points2D = PointListReader<Z2i::Point>::getPointsFromInputStream( in2, vectPos );
+  bool ok = points2D.size() == expected.size();
+  for ( unsigned int i = 0; ok && i < points2D.size(); ++i )
+    ok = points2D[ i ] == Z2i::Point( (int) expected[ i ][ 2 ], (int) expected[ i ][ 0 ] );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "selected coordinates" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Writes and reads point lists in text and binary formats.
+ */
+bool testBinaryPointList()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing binary point lists ..." );
+  std::vector<Z3i::Point> points;
+  for ( int i = 0; i < 1000; ++i )
+    points.push_back( Z3i::Point( i, -i, i * i ) );
+
+  PointListWriter<Z3i::Point>::exportToBinaryFile( "testPointList.bin", points );
+  nbok += PointListReader<Z3i::Point>::getPointsFromBinaryFile( "testPointList.bin" ) == points ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "same type" << std::endl;
+
+  // Conversion of the coordinates.
+  std::vector<Z3i::RealPoint> realPoints
+    = PointListReader<Z3i::RealPoint>::getPointsFromBinaryFile( "testPointList.bin" );
+  bool ok = realPoints.size() == points.size();
+  for ( unsigned int i = 0; ok && i < points.size(); ++i )
+    ok = realPoints[ i ] == Z3i::RealPoint( points[ i ][ 0 ], points[ i ][ 1 ], points[ i ][ 2 ] );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "converted type" << std::endl;
+
+  // Wrong dimension.
+  bool hasThrown = false;
+  try {
+    PointListReader<Z2i::Point>::getPointsFromBinaryFile( "testPointList.bin" );
+  } catch ( IOException & ) {
+    hasThrown = true;
+  }
+  nbok += hasThrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "wrong dimension" << std::endl;
+
+  // Count of the header larger than the file.
+  std::ifstream binFile( "testPointList.bin", std::ios::binary );
+  std::string bytes( ( std::istreambuf_iterator<char>( binFile ) ),
+                     std::istreambuf_iterator<char>() );
+  const uint64_t hugeCount = uint64_t( 1 ) << 60;
+  std::memcpy( &bytes[ 24 ], &hugeCount, sizeof( hugeCount ) );
+  std::istringstream corrupted( bytes );
+  hasThrown = false;
+  try {
+    PointListReader<Z3i::Point>::getPointsFromBinaryInputStream( corrupted );
+  } catch ( IOException & ) {
+    hasThrown = true;
+  }
+  nbok += hasThrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "corrupted count" << std::endl;
+
+  // Text round trip.
+  PointListWriter<Z3i::Point>::exportToFile( "testPointList.pl", points );
+  nbok += PointListReader<Z3i::Point>::getPointsFromFile( "testPointList.pl" ) == points ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << "text" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +245,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
   
   
-  bool res = testPointListReader(); // && ... other tests
+  bool res = testPointListReader() && testLargePointList()
+    && testBinaryPointList(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
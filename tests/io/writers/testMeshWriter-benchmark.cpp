@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshWriter-benchmark.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of mesh export and import in OFF, OBJ and PLY formats,
+ * compared with plain std::ostream formatting.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/writers/MeshWriter.h"
+#include "DGtal/io/readers/MeshReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking mesh input/output.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef Z3i::RealPoint RealPoint;
+
+/// Builds a triangulated sphere with about 2 n^2 vertices.
+void makeSphere( Mesh<RealPoint> & mesh, unsigned int n )
+{
+  for ( unsigned int i = 0; i <= n; ++i )
+    for ( unsigned int j = 0; j < 2 * n; ++j )
+      {
+        const double theta = M_PI * i / n;
+        const double phi   = M_PI * j / n;
+        mesh.addVertex( RealPoint( sin( theta ) * cos( phi ),
+                                   sin( theta ) * sin( phi ), cos( theta ) ) );
+      }
+  for ( unsigned int i = 0; i < n; ++i )
+    for ( unsigned int j = 0; j < 2 * n; ++j )
+      {
+        const unsigned int a = i * 2 * n + j;
+        const unsigned int b = i * 2 * n + ( j + 1 ) % ( 2 * n );
+        mesh.addTriangularFace( a, b, a + 2 * n );
+        mesh.addTriangularFace( b, b + 2 * n, a + 2 * n );
+      }
+}
+
+/// Exports the mesh as OFF with std::ostream formatting, as done before.
+void exportOFFWithOstream( std::ostream & out, const Mesh<RealPoint> & mesh )
+{
+  out << "OFF" << std::endl;
+  out << mesh.nbVertex() << " " << mesh.nbFaces() << " " << 0 << " " << std::endl;
+  for ( unsigned int i = 0; i < mesh.nbVertex(); i++ )
+    out << mesh.getVertex( i )[ 0 ] << " " << mesh.getVertex( i )[ 1 ] << " "
+        << mesh.getVertex( i )[ 2 ] << std::endl;
+  for ( unsigned int i = 0; i < mesh.nbFaces(); i++ )
+    {
+      const std::vector<unsigned int> & aFace = mesh.getFace( i );
+      out << aFace.size() << " ";
+      for ( unsigned int j = 0; j < aFace.size(); j++ )
+        out << aFace[ j ] << " ";
+      out << std::endl;
+    }
+}
+
+bool benchmarkMesh( unsigned int n )
+{
+  Mesh<RealPoint> mesh;
+  makeSphere( mesh, n );
+  trace.beginBlock( "Benchmarking mesh with " + std::to_string( mesh.nbVertex() )
+                    + " vertices and " + std::to_string( mesh.nbFaces() ) + " faces" );
+
+  trace.beginBlock( "OFF export with std::ostream" );
+  {
+    std::ofstream out( "benchmark-ostream.off" );
+    exportOFFWithOstream( out, mesh );
+  }
+  trace.endBlock();
+
+  trace.beginBlock( "OFF export with MeshWriter" );
+  {
+    std::ofstream out( "benchmark.off" );
+    MeshWriter<RealPoint>::export2OFF( out, mesh );
+  }
+  trace.endBlock();
+
+  trace.beginBlock( "OBJ export with MeshWriter" );
+  {
+    std::ofstream out( "benchmark.obj" );
+    MeshWriter<RealPoint>::export2OBJ( out, mesh );
+  }
+  trace.endBlock();
+
+  trace.beginBlock( "binary PLY export with MeshWriter" );
+  {
+    std::ofstream out( "benchmark.ply", std::ofstream::out | std::ofstream::binary );
+    MeshWriter<RealPoint>::export2PLY( out, mesh );
+  }
+  trace.endBlock();
+
+  bool ok = true;
+  const char* files[] = { "benchmark.off", "benchmark.obj", "benchmark.ply" };
+  for ( const char* file : files )
+    {
+      trace.beginBlock( std::string( "Import of " ) + file );
+      Mesh<RealPoint> readMesh;
+      ok = ok && ( readMesh << std::string( file ) )
+        && readMesh.nbVertex() == mesh.nbVertex()
+        && readMesh.nbFaces() == mesh.nbFaces();
+      trace.endBlock();
+    }
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking MeshWriter and MeshReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  for ( unsigned int n = 100; n <= 400; n *= 2 )
+    res = res && benchmarkMesh( n );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -363,6 +363,75 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetBySTLVectorAlgebra()
+{
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetBySTLVector<Domain> VectorSet;
+  typedef DigitalSetBySTLSet<Domain> STLSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Set algebra of DigitalSetBySTLVector" );
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  srand( 0 );
+  std::vector<Point> points1, points2;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      points1.push_back( Point( rand() % 21 - 10, rand() % 21 - 10, rand() % 21 - 10 ) );
+      points2.push_back( Point( rand() % 21 - 10, rand() % 21 - 10, rand() % 21 - 10 ) );
+    }
+  VectorSet v1( domain ), v2( domain ), v3( domain );
+  STLSet s1( domain ), s2( domain );
+  v1.insert( points1.begin(), points1.end() );
+  for ( unsigned int i = 0; i < points2.size(); ++i )
+    v2.insert( points2[ i ] );
+  s1.insert( points1.begin(), points1.end() );
+  s2.insert( points2.begin(), points2.end() );
+  // bulk insertion in a non-empty set.
+  v3.insert( points1.begin(), points1.begin() + 1000 );
+  v3.insert( points1.begin() + 500, points1.end() );
+  INBLOCK_TEST( v1.isValid() && v2.isValid() && v3.isValid() );
+  INBLOCK_TEST( v1.size() == s1.size() && v2.size() == s2.size() );
+  INBLOCK_TEST( std::equal( v1.begin(), v1.end(), v3.begin() ) && v1.size() == v3.size() );
+  bool ok = true;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    ok = ok && ( v1( *it ) == s1( *it ) ) && ( v2( *it ) == s2( *it ) );
+  INBLOCK_TEST2( ok, "same points as DigitalSetBySTLSet" );
+  // points are sorted in the order of the domain.
+  VectorSet vDomain( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( s1( *it ) ) vDomain.insertNew( *it );
+  INBLOCK_TEST( std::equal( v1.begin(), v1.end(), vDomain.begin() ) );
+
+  VectorSet vUnion( v1 ), vInter( v1 ), vDiff( v1 );
+  vUnion += v2;
+  vInter *= v2;
+  vDiff -= v2;
+  bool okUnion = true, okInter = true, okDiff = true;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      okUnion = okUnion && ( vUnion( *it ) == ( s1( *it ) || s2( *it ) ) );
+      okInter = okInter && ( vInter( *it ) == ( s1( *it ) && s2( *it ) ) );
+      okDiff = okDiff && ( vDiff( *it ) == ( s1( *it ) && ! s2( *it ) ) );
+    }
+  INBLOCK_TEST2( okUnion && vUnion.isValid(), "union" );
+  INBLOCK_TEST2( okInter && vInter.isValid(), "intersection" );
+  INBLOCK_TEST2( okDiff && vDiff.isValid(), "difference" );
+  INBLOCK_TEST( vInter.size() + vDiff.size() == v1.size() );
+
+  // erasing keeps the points sorted.
+  vUnion.erase( vUnion.begin() + 10 );
+  vUnion.erase( vUnion.begin() + 20, vUnion.begin() + 40 );
+  vUnion.erase( *v2.begin() );
+  INBLOCK_TEST( vUnion.isValid() && ! vUnion( *v2.begin() ) );
+  vDiff -= vDiff;
+  INBLOCK_TEST( vDiff.empty() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<Z2i::DigitalSet> ));
@@ -442,10 +511,12 @@ int main()
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
+  bool okVectorAlgebra = testDigitalSetBySTLVectorAlgebra();
+
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
-     && okUnorderedSet && okAssoctestSet;
+     && okUnorderedSet && okAssoctestSet && okVectorAlgebra;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
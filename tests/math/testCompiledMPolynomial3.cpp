@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompiledMPolynomial3.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class CompiledMPolynomial3.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompiledMPolynomial3.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  typedef MPolynomial<3, double>        Polynomial3;
+  typedef CompiledMPolynomial3<double>  Compiled3;
+
+  Polynomial3 readPolynomial( const std::string & str )
+  {
+    Polynomial3 P;
+    MPolynomialReader<3, double> reader;
+    std::string::const_iterator it = reader.read( P, str.begin(), str.end() );
+    REQUIRE( it == str.end() );
+    return P;
+  }
+
+  bool close( double a, double b )
+  {
+    return std::abs( a - b ) <= 1e-9 * ( 1.0 + std::abs( a ) + std::abs( b ) );
+  }
+}
+
+TEST_CASE( "Testing CompiledMPolynomial3" )
+{
+  const std::string polys[] =
+    { "x^2+y^2+z^2-81",
+      "x^3*y+x*z^3+y^3*z+z^3+5*z",
+      "(x^2+y^2+z^2+6*6-2*2)^2-4*6*6*(x^2+y^2)",
+      "-1*(8-0.03*x^4-0.03*y^4-0.03*z^4+2*x^2+2*y^2+2*z^2)",
+      "x^2-(y^2+z^2)^2",
+      "3.5" };
+  SECTION( "Zero polynomial" )
+    {
+      Compiled3 C;
+      REQUIRE( C.isValid() );
+      REQUIRE( C.nbCoefficients() == 0 );
+      double fx, fy, fz;
+      REQUIRE( C.valueAndGradient( 1.0, 2.0, 3.0, fx, fy, fz ) == 0.0 );
+      REQUIRE( ( fx == 0.0 && fy == 0.0 && fz == 0.0 ) );
+    }
+
+  SECTION( "Values and gradients of single points" )
+    {
+      srand( 0 );
+      for ( unsigned int i = 0; i < 6; ++i )
+        {
+          const Polynomial3 P  = readPolynomial( polys[ i ] );
+          const Polynomial3 Px = derivative<0>( P );
+          const Polynomial3 Py = derivative<1>( P );
+          const Polynomial3 Pz = derivative<2>( P );
+          const Compiled3 C( P );
+          REQUIRE( C.isValid() );
+          unsigned int nbok = 0;
+          for ( unsigned int j = 0; j < 100; ++j )
+            {
+              const double x = ( rand() % 2000 ) / 100.0 - 10.0;
+              const double y = ( rand() % 2000 ) / 100.0 - 10.0;
+              const double z = ( rand() % 2000 ) / 100.0 - 10.0;
+              double fx, fy, fz;
+              const double v = C.valueAndGradient( x, y, z, fx, fy, fz );
+              nbok += ( v == C( x, y, z ) )
+                && close( v,  P ( x )( y )( z ) )
+                && close( fx, Px( x )( y )( z ) )
+                && close( fy, Py( x )( y )( z ) )
+                && close( fz, Pz( x )( y )( z ) ) ? 1 : 0;
+            }
+          REQUIRE( nbok == 100 );
+        }
+    }
+
+  SECTION( "Batch evaluation" )
+    {
+      // 37 is not a multiple of the number of lanes.
+      const unsigned int n = 37;
+      std::vector<double> x( n ), y( n ), z( n );
+      for ( unsigned int j = 0; j < n; ++j )
+        {
+          x[ j ] = 0.37 * j - 7.0;
+          y[ j ] = 5.0 - 0.21 * j;
+          z[ j ] = 0.5 * ( j % 9 ) - 2.0;
+        }
+      for ( unsigned int i = 0; i < 6; ++i )
+        {
+          const Compiled3 C( readPolynomial( polys[ i ] ) );
+          std::vector<double> v( n ), w( n ), fx( n ), fy( n ), fz( n );
+          C.evaluate( n, x.data(), y.data(), z.data(), v.data() );
+          C.evaluate( n, x.data(), y.data(), z.data(), w.data(),
+                      fx.data(), fy.data(), fz.data() );
+          unsigned int nbok = 0;
+          for ( unsigned int j = 0; j < n; ++j )
+            {
+              double gx, gy, gz;
+              const double u = C.valueAndGradient( x[ j ], y[ j ], z[ j ],
+                                                   gx, gy, gz );
+              nbok += ( v[ j ] == u ) && ( w[ j ] == u )
+                && ( fx[ j ] == gx ) && ( fy[ j ] == gy ) && ( fz[ j ] == gz )
+                ? 1 : 0;
+            }
+          REQUIRE( nbok == n );
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,137 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshVoxelization-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Benchmarks the voxelization of a mesh into a digital set and into
+ * an image, and its solid voxelization, with class MeshVoxelizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshVoxelizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class MeshVoxelizer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Builds a triangulated sphere (latitude/longitude) with about @a
+ * nbTriangles triangles.
+ */
+void makeSphere( Mesh<Z3i::RealPoint> & mesh, double radius,
+                 unsigned int nbTriangles )
+{
+  const unsigned int nbLat = std::max( 2u, (unsigned int) std::sqrt( nbTriangles / 4.0 ) );
+  const unsigned int nbLon = 2 * nbLat;
+  for ( unsigned int i = 0; i <= nbLat; ++i )
+    {
+      const double theta = M_PI * i / nbLat;
+      for ( unsigned int j = 0; j < nbLon; ++j )
+        {
+          const double phi = 2.0 * M_PI * j / nbLon;
+          mesh.addVertex( Z3i::RealPoint( radius * sin( theta ) * cos( phi ),
+                                          radius * sin( theta ) * sin( phi ),
+                                          radius * cos( theta ) ) );
+        }
+    }
+  for ( unsigned int i = 0; i < nbLat; ++i )
+    for ( unsigned int j = 0; j < nbLon; ++j )
+      {
+        const unsigned int a = i * nbLon + j;
+        const unsigned int b = i * nbLon + ( j + 1 ) % nbLon;
+        const unsigned int c = a + nbLon;
+        const unsigned int d = b + nbLon;
+        mesh.addTriangularFace( a, c, d );
+        mesh.addTriangularFace( a, d, b );
+      }
+}
+
+template <typename Voxelizer>
+bool benchmarkMeshVoxelizer( const std::string & name,
+                             const Mesh<Z3i::RealPoint> & mesh,
+                             const Z3i::Domain & domain )
+{
+  typedef typename Voxelizer::DigitalSet DigitalSet;
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> Image;
+  Voxelizer voxelizer;
+
+  trace.beginBlock( name + " into a digital set" );
+  DigitalSet set( domain );
+  voxelizer.voxelize( set, mesh );
+  double tSet = trace.endBlock();
+
+  trace.beginBlock( name + " into an image" );
+  Image image( domain );
+  voxelizer.voxelizeInImage( image, mesh, true );
+  double tImage = trace.endBlock();
+
+  const unsigned int nbVoxels =
+    (unsigned int) std::count( image.begin(), image.end(), true );
+
+  trace.beginBlock( name + " solid into an image" );
+  Image solid( domain );
+  voxelizer.voxelizeSolidInImage( solid, mesh, true );
+  double tSolid = trace.endBlock();
+
+  const unsigned int nbSolid =
+    (unsigned int) std::count( solid.begin(), solid.end(), true );
+  std::cout << name << " " << mesh.nbFaces() << " " << set.size()
+            << " " << tSet << " " << tImage
+            << " " << nbSolid << " " << tSolid << std::endl;
+  return nbVoxels == set.size();
+}
+
+int main( int argc, char** argv )
+{
+  unsigned int nbTriangles = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  double radius = ( argc > 2 ) ? atof( argv[ 2 ] ) : 200.0;
+  std::cout << "# Usage: " << argv[0] << " <nbtriangles> <radius>." << std::endl;
+  std::cout << "# Voxelizes a sphere of the given radius made of about nbtriangles triangles (e.g. 10000000)." << std::endl;
+
+  Mesh<Z3i::RealPoint> mesh;
+  trace.beginBlock( "Building the sphere mesh" );
+  makeSphere( mesh, radius, nbTriangles );
+  trace.endBlock();
+  const int r = (int) std::ceil( radius ) + 1;
+  Z3i::Domain domain( Z3i::Point::diagonal( -r ), Z3i::Point::diagonal( r ) );
+
+  std::cout << "# Separation nbfaces nbvoxels time-set(ms) time-image(ms) nbsolidvoxels time-solid(ms)" << std::endl;
+  bool res = benchmarkMeshVoxelizer< MeshVoxelizer<Z3i::DigitalSet, 6> >
+    ( "6", mesh, domain );
+  res = res && benchmarkMeshVoxelizer< MeshVoxelizer<Z3i::DigitalSet, 26> >
+    ( "26", mesh, domain );
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
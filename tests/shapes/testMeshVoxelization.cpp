@@ -36,6 +36,7 @@
 #include "DGtal/io/Display3D.h"
 #include "DGtal/io/readers/MeshReader.h"
 #include "DGtal/io/boards/Board3D.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace DGtal;
@@ -232,4 +233,73 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("Voxelization of a OFF cube mesh into an image")
+  {
+    using Image = ImageContainerBySTLVector<Domain, bool>;
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    // the domain cuts the box.
+    Z3i::Domain domain( Point(-30,-30,-4), Point(30,30,30));
+    for ( int sep = 0; sep < 2; ++sep )
+    {
+      DigitalSet outputSet(domain);
+      Image image(domain);
+      std::fill( image.begin(), image.end(), false );
+      if ( sep == 0 )
+      {
+        MeshVoxelizer6 voxelizer;
+        voxelizer.voxelize(outputSet, inputMesh, 10.0 );
+        voxelizer.voxelizeInImage(image, inputMesh, true, 10.0 );
+      }
+      else
+      {
+        MeshVoxelizer26 voxelizer;
+        voxelizer.voxelize(outputSet, inputMesh, 10.0 );
+        voxelizer.voxelizeInImage(image, inputMesh, true, 10.0 );
+      }
+      unsigned int nbVoxels = 0;
+      bool same = true;
+      for ( auto p : domain )
+      {
+        nbVoxels += image( p ) ? 1 : 0;
+        same = same && ( image( p ) == ( outputSet.find( p ) != outputSet.end() ) );
+      }
+      CAPTURE( sep );
+      REQUIRE( nbVoxels == outputSet.size() );
+      REQUIRE( same );
+      REQUIRE( outputSet.size() > 0 );
+    }
+  }
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of a OFF cube mesh into an image")
+  {
+    using Image = ImageContainerBySTLVector<Domain, bool>;
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    // The box is |x|+|y| <= 16.32993, |z| <= 11.54701 once scaled.
+    for ( int cut = 0; cut < 2; ++cut )
+    {
+      Z3i::Domain domain( Point(-30,-30, cut == 0 ? -30 : -4), Point(30,30,30));
+      Image image(domain);
+      std::fill( image.begin(), image.end(), false );
+      MeshVoxelizer6 voxelizer;
+      voxelizer.voxelizeSolidInImage(image, inputMesh, true, 10.0 );
+      unsigned int nbVoxels = 0;
+      bool same = true;
+      for ( auto p : domain )
+      {
+        const bool inside = ( std::abs( p[0] ) + std::abs( p[1] ) <= 16.32993 )
+          && ( std::abs( p[2] ) <= 11.54701 );
+        nbVoxels += image( p ) ? 1 : 0;
+        same = same && ( image( p ) == inside );
+      }
+      CAPTURE( cut );
+      CAPTURE( nbVoxels );
+      REQUIRE( same );
+      REQUIRE( nbVoxels == ( cut == 0 ? 545u * 23u : 545u * 16u ) );
+    }
+  }
 }
+
+
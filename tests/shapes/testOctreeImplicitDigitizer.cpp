@@ -0,0 +1,133 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOctreeImplicitDigitizer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class OctreeImplicitDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/images/PackedBinaryImage.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/OctreeImplicitDigitizer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OctreeImplicitDigitizer.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  typedef Z3i::Space                                     Space;
+  typedef ImplicitPolynomial3Shape<Space>                ImplicitShape;
+  typedef ImplicitShape::Polynomial3                     Polynomial3;
+  typedef GaussDigitizer<Space, ImplicitShape>           Digitizer;
+  typedef OctreeImplicitDigitizer<Space, ImplicitShape>  Octree;
+  typedef PackedBinaryImage<Z3i::Domain>                 BinaryImage;
+
+  Polynomial3 readPolynomial( const std::string & str )
+  {
+    Polynomial3 P;
+    MPolynomialReader<3, double> reader;
+    std::string::const_iterator it = reader.read( P, str.begin(), str.end() );
+    REQUIRE( it == str.end() );
+    return P;
+  }
+}
+
+TEST_CASE( "Testing intervalBounds of MPolynomial" )
+{
+  const std::string polys[] = { "x^2+y^2+z^2-81", "x^3*y-2*z+0.5*x*y*z",
+                                "(x^2+y^2+z^2+6*6-2*2)^2-4*6*6*(x^2+y^2)" };
+  srand( 0 );
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      const Polynomial3 P = readPolynomial( polys[ i ] );
+      unsigned int nbok = 0;
+      for ( unsigned int j = 0; j < 100; ++j )
+        {
+          double lo[ 3 ], up[ 3 ], x[ 3 ];
+          for ( unsigned int k = 0; k < 3; ++k )
+            {
+              lo[ k ] = ( rand() % 200 ) / 10.0 - 10.0;
+              up[ k ] = lo[ k ] + ( rand() % 50 ) / 10.0;
+              x [ k ] = lo[ k ] + ( up[ k ] - lo[ k ] ) * ( rand() % 101 ) / 100.0;
+            }
+          double vmin, vmax, magnitude;
+          intervalBounds( P, lo, up, vmin, vmax, magnitude );
+          const double v = P( x[ 0 ] )( x[ 1 ] )( x[ 2 ] );
+          nbok += ( vmin <= v ) && ( v <= vmax )
+            && ( std::abs( v ) <= magnitude ) ? 1 : 0;
+        }
+      REQUIRE( nbok == 100 );
+    }
+  // The bounds of x^2 on [-1,2] are exact.
+  const Polynomial3 X2 = readPolynomial( "x^2" );
+  const double lo[ 3 ] = { -1.0, 0.0, 0.0 }, up[ 3 ] = { 2.0, 1.0, 1.0 };
+  double vmin, vmax, magnitude;
+  intervalBounds( X2, lo, up, vmin, vmax, magnitude );
+  REQUIRE( vmin == 0.0 );
+  REQUIRE( vmax == 4.0 );
+}
+
+TEST_CASE( "Testing OctreeImplicitDigitizer" )
+{
+  const std::string polys[] =
+    { "x^2+y^2+z^2-81",
+      "(x^2+y^2+z^2+6*6-2*2)^2-4*6*6*(x^2+y^2)",
+      "-1*(8-0.03*x^4-0.03*y^4-0.03*z^4+2*x^2+2*y^2+2*z^2)",
+      "x^2-(y^2+z^2)^2" };
+  for ( unsigned int i = 0; i < 4; ++i )
+    {
+      ImplicitShape shape( readPolynomial( polys[ i ] ) );
+      Digitizer dig;
+      dig.attach( shape );
+      dig.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ),
+                Z3i::RealPoint(  10.0,  10.0,  10.0 ), 0.25 );
+      const Z3i::Domain domain = dig.getDomain();
+      BinaryImage image( domain, true );
+      Octree octree( dig );
+      const Octree::Size nbEvaluated = octree.digitize( image );
+      unsigned int nbok = 0;
+      for ( auto p : domain )
+        nbok += image( p ) == dig( p ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+      // Only the points near the boundary are evaluated.
+      REQUIRE( nbEvaluated < domain.size() / 2 );
+      REQUIRE( image.count() > 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CConstSinglePassRange.h"
 #include "DGtal/topology/DigitalSurface.h"
@@ -661,6 +662,97 @@ bool testOrderingDigitalSurfaceFacesAroundVertex()
   return nb == nbok;
 }
 
+//-----------------------------------------------------------------------------
+// Testing cached face ranges
+//-----------------------------------------------------------------------------
+template <typename TDigitalSurface>
+bool checkFaceRanges( const TDigitalSurface & digsurf,
+                      unsigned int & nb_closed, unsigned int & nb_open )
+{
+  typedef typename TDigitalSurface::Face      Face;
+  typedef typename TDigitalSurface::FaceRange FaceRange;
+  // Reference faces, computed as umbrellas around every vertex.
+  std::set<Face> closed_faces, open_faces;
+  for ( auto v : digsurf )
+    for ( auto f : digsurf.facesAroundVertex( v ) )
+      ( f.isClosed() ? closed_faces : open_faces ).insert( f );
+  nb_closed = closed_faces.size();
+  nb_open   = open_faces.size();
+  bool ok = true;
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      FaceRange closed_range, open_range;
+      digsurf.computeFaces( closed_range, open_range, i == 0 );
+      ok = ok
+        && closed_range == FaceRange( closed_faces.begin(), closed_faces.end() )
+        && open_range   == FaceRange( open_faces.begin(), open_faces.end() );
+      for ( auto f : closed_range )
+        ok = ok && f.nbVertices == digsurf.verticesAroundFace( f ).size();
+    }
+  ok = ok && digsurf.allClosedFaceRange().size() == nb_closed
+    && digsurf.allOpenFaceRange().size() == nb_open
+    && digsurf.allFaces().size() == nb_closed + nb_open;
+  return ok;
+}
+
+bool testFaceRanges()
+{
+  using namespace Z3i;
+  typedef DigitalSetBoundary<KSpace,DigitalSet>            Boundary;
+  typedef ImageContainerBySTLVector<Domain,DGtal::uint8_t> Image;
+  typedef FrontierPredicate<KSpace, Image>                 SurfelPredicate;
+  typedef ExplicitDigitalSurface<KSpace,SurfelPredicate>   Frontier;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing face ranges" );
+  Point p1( -6, -6, -6 );
+  Point p2( 6, 6, 6 );
+  KSpace K;
+  nbok += K.init( p1, p2, true ) ? 1 : 0;
+  nb++;
+  {
+    Domain domain( p1, p2 );
+    DigitalSet shape( domain );
+    for ( auto p : domain )
+      if ( p.norm() <= 4.5 || ( p[ 0 ] == 5 && p[ 1 ] >= 0 && p[ 2 ] == 0 ) )
+        shape.insert( p );
+    // The line of voxels touches the bounds of K, where umbrellas are open.
+    DigitalSurface<Boundary> digsurf( new Boundary( K, shape ) );
+    unsigned int nb_closed, nb_open;
+    ++nb; nbok += checkFaceRanges( digsurf, nb_closed, nb_open ) ? 1 : 0;
+    ++nb; nbok += ( nb_closed == 436 && nb_open == 4 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "boundary: " << nb_closed << " closed faces, "
+                 << nb_open << " open faces" << std::endl;
+    // Ranges are returned by value, hence kept by the caller.
+    const DigitalSurface<Boundary>::FaceRange closed_faces = digsurf.allClosedFaceRange();
+    digsurf.container();
+    ++nb; nbok += closed_faces.size() == nb_closed ? 1 : 0;
+  }
+  {
+    Image image( Domain( p1, p2 ) );
+    fillImage3D( image, p1, p2, 0 );
+    fillImage3D( image, Point(-2,-2,-2 ), Point( 2, 2, 2 ), 1 );
+    fillImage3D( image, Point( 0, 0,-2 ), Point( 0, 0, 2 ), 2 );
+    fillImage3D( image, Point(-1,-1, 2 ), Point( 1, 1, 2 ), 2 );
+    SCell vox2  = K.sSpel( Point( 0, 0, 2 ), K.POS );
+    SCell bel20 = K.sIncident( vox2, 2, true );
+    SurfelPredicate surfPredicate( K, image, 2, 0 );
+    DigitalSurface<Frontier> digsurf
+      ( new Frontier( K, surfPredicate,
+                      SurfelAdjacency<KSpace::dimension>( true ), bel20 ) );
+    unsigned int nb_closed, nb_open;
+    ++nb; nbok += checkFaceRanges( digsurf, nb_closed, nb_open ) ? 1 : 0;
+    ++nb; nbok += ( nb_closed == 4 && nb_open == 8 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "open surface: " << nb_closed << " closed faces, "
+                 << nb_open << " open faces" << std::endl;
+  }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -680,7 +772,8 @@ int main( int argc, char** argv )
     && testDigitalSurface<KhalimskySpaceND<2> >()
     && testDigitalSurface<KhalimskySpaceND<3> >()
     && testDigitalSurface<KhalimskySpaceND<4> >()
-    && testOrderingDigitalSurfaceFacesAroundVertex();
+    && testOrderingDigitalSurfaceFacesAroundVertex()
+    && testFaceRanges();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
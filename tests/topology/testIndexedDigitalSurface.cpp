@@ -93,6 +93,20 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
       REQUIRE( K.sOpp( dsurf.linel( 112 ) ) == dsurf.linel( dsurf.opposite( 112 ) ) );
       REQUIRE( K.sOpp( dsurf.linel( 200 ) ) == dsurf.linel( dsurf.opposite( 200 ) ) );
     }
+    THEN( "Cells and indices are mapped one to one" ) {
+      unsigned int nbok = 0;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        nbok += dsurf.getVertex( dsurf.surfel( v ) ) == v ? 1 : 0;
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        nbok += dsurf.getArc( dsurf.linel( a ) ) == a ? 1 : 0;
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        nbok += dsurf.getFace( dsurf.pointel( f ) ) == f ? 1 : 0;
+      REQUIRE( nbok == 174 + 2 * 348 + 176 );
+    }
+    THEN( "Memory used by the surface and by its construction is reported" ) {
+      REQUIRE( dsurf.heapMemory() > 0 );
+      REQUIRE( dsurf.buildPeakMemory() >= dsurf.heapMemory() );
+    }
     THEN( "Breadth-first visiting the digital surface from vertex 0 goes to a distance 13." ) {
       BreadthFirstVisitor< DigSurface > visitor( dsurf, 0 );
       std::vector<int> vertices;
@@ -107,6 +121,24 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
       REQUIRE( distances.size() == 174 );
       REQUIRE( distances.back() == 13 );
     }      
+    THEN( "Vertices may be numbered in any given order of the surfels" ) {
+      DigSurface::SCellStorage surfels;
+      for ( DigSurface::Vertex v = dsurf.nbVertices(); v-- > 0; )
+        surfels.push_back( dsurf.surfel( v ) );
+      DigSurface rsurf;
+      REQUIRE( rsurf.build( new DigitalSurfaceContainer( K, aSet ), surfels ) );
+      REQUIRE( rsurf.nbVertices() == 174 );
+      REQUIRE( rsurf.nbFaces() == 176 );
+      REQUIRE( rsurf.Euler() == 2 );
+      unsigned int nbok = 0;
+      for ( DigSurface::Vertex v = 0; v < rsurf.nbVertices(); ++v )
+        nbok += ( rsurf.surfel( v ) == surfels[ v ]
+                  && rsurf.getVertex( surfels[ v ] ) == v ) ? 1 : 0;
+      REQUIRE( nbok == 174 );
+      surfels.back() = surfels.front();
+      DigSurface wsurf;
+      REQUIRE( ! wsurf.build( new DigitalSurfaceContainer( K, aSet ), surfels ) );
+    }
   }
 }
 
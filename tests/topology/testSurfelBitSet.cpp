@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelBitSet.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class SurfelBitSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include <atomic>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/SurfelBitSet.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/LightExplicitDigitalSurface.h"
+#include "DGtal/topology/SurfelSetPredicate.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfelBitSet.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing SurfelBitSet as a set of surfels" )
+{
+  typedef Z3i::KSpace           KSpace;
+  typedef SurfelBitSet<KSpace>  BitSet;
+  KSpace K;
+  K.init( Z3i::Point( -3, -2, 0 ), Z3i::Point( 4, 5, 6 ), true );
+  // Random surfels, including the ones on the borders of the space.
+  srand( 0 );
+  std::vector<KSpace::SCell> surfels;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Dimension k = rand() % 3;
+      Z3i::Point c;
+      for ( Dimension j = 0; j < 3; ++j )
+        {
+          const int lo = 2 * K.lowerBound()[ j ];
+          const int up = 2 * K.upperBound()[ j ] + 2;
+          c[ j ] = j == k
+            ? lo + 2 * ( rand() % ( ( up - lo ) / 2 + 1 ) )
+            : lo + 1 + 2 * ( rand() % ( ( up - lo ) / 2 ) );
+        }
+      surfels.push_back( K.sCell( c, rand() % 2 ? K.POS : K.NEG ) );
+    }
+  BitSet      bits( K );
+  REQUIRE( bits.isBitmap() );
+  KSpace::SCellSet cells;
+  unsigned int nbok = 0;
+  for ( auto&& s : surfels )
+    nbok += ( bits.insert( s ).second == cells.insert( s ).second ) ? 1 : 0;
+  REQUIRE( nbok == surfels.size() );
+  REQUIRE( bits.size() == cells.size() );
+
+  SECTION( "Iteration gives the surfels of the set" )
+    {
+      KSpace::SCellSet visited( bits.begin(), bits.end() );
+      REQUIRE( visited == cells );
+      unsigned int nb = 0;
+      for ( auto it = bits.begin(), itE = bits.end(); it != itE; ++it, ++nb )
+        if ( bits.find( *it ) != it ) break;
+      REQUIRE( nb == cells.size() );
+    }
+
+  SECTION( "Erasing surfels" )
+    {
+      nbok = 0;
+      for ( unsigned int i = 0; i < surfels.size(); i += 3 )
+        nbok += ( bits.erase( surfels[ i ] ) == cells.erase( surfels[ i ] ) ) ? 1 : 0;
+      REQUIRE( nbok == ( surfels.size() + 2 ) / 3 );
+      REQUIRE( bits.size() == cells.size() );
+      nbok = 0;
+      for ( auto&& s : surfels )
+        nbok += ( bits.count( s ) == cells.count( s ) ) ? 1 : 0;
+      REQUIRE( nbok == surfels.size() );
+      bits.erase( bits.begin() );
+      REQUIRE( bits.size() + 1 == cells.size() );
+      bits.clear();
+      REQUIRE( bits.empty() );
+      REQUIRE( bits.begin() == bits.end() );
+    }
+
+  SECTION( "Concurrent insertions" )
+    {
+      BitSet other( K );
+      other.allocatePages();
+      nbok = 0;
+      for ( auto&& s : surfels )
+        nbok += other.insertConcurrently( s ) ? 1 : 0;
+      REQUIRE( nbok == cells.size() );
+      other.updateSize();
+      REQUIRE( other.size() == cells.size() );
+      REQUIRE( KSpace::SCellSet( other.begin(), other.end() ) == cells );
+    }
+}
+
+TEST_CASE( "Testing SurfelBitSet in a huge space" )
+{
+  typedef Z3i::KSpace           KSpace;
+  typedef SurfelBitSet<KSpace>  BitSet;
+  KSpace K;
+  K.init( Z3i::Point::diagonal( -1000000 ), Z3i::Point::diagonal( 1000000 ), true );
+  srand( 0 );
+  std::vector<KSpace::SCell> surfels;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Dimension k = rand() % 3;
+      Z3i::Point c;
+      for ( Dimension j = 0; j < 3; ++j )
+        c[ j ] = 2 * ( rand() % 20 - 10 ) + ( j == k ? 0 : 1 );
+      surfels.push_back( K.sCell( c, rand() % 2 ? K.POS : K.NEG ) );
+    }
+  BitSet      bits( K );
+  REQUIRE( ! bits.isBitmap() );
+  REQUIRE( bits.isValid() );
+  KSpace::SCellSet cells;
+  unsigned int nbok = 0;
+  for ( auto&& s : surfels )
+    nbok += ( bits.insert( s ).second == cells.insert( s ).second ) ? 1 : 0;
+  REQUIRE( nbok == surfels.size() );
+  REQUIRE( bits.size() == cells.size() );
+  REQUIRE( KSpace::SCellSet( bits.begin(), bits.end() ) == cells );
+  nbok = 0;
+  for ( unsigned int i = 0; i < surfels.size(); i += 3 )
+    nbok += ( bits.erase( surfels[ i ] ) == cells.erase( surfels[ i ] ) ) ? 1 : 0;
+  REQUIRE( nbok == ( surfels.size() + 2 ) / 3 );
+  nbok = 0;
+  for ( auto&& s : surfels )
+    nbok += ( bits.count( s ) == cells.count( s )
+              && ( bits.find( s ) != bits.end() ) == ( cells.count( s ) != 0 ) ) ? 1 : 0;
+  REQUIRE( nbok == surfels.size() );
+  BitSet other( K );
+  other.allocatePages();
+  nbok = 0;
+  for ( auto&& s : surfels )
+    nbok += other.insertConcurrently( s ) ? 1 : 0;
+  other.updateSize();
+  REQUIRE( other.size() == nbok );
+  bits.clear();
+  REQUIRE( bits.begin() == bits.end() );
+}
+
+TEST_CASE( "Testing traversals of LightImplicitDigitalSurface with SurfelBitSet" )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef LightImplicitDigitalSurface<KSpace, Z3i::DigitalSet> Surface;
+  const Z3i::Point lo( -10, -10, -10 ), up( 10, 10, 10 );
+  Z3i::Domain  domain( lo, up );
+  Z3i::DigitalSet ball( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( ball, Z3i::Point( 0, 0, 0 ), 8 );
+  KSpace K;
+  K.init( lo, up, true );
+  KSpace::SCellSet boundary;
+  Surfaces<KSpace>::sMakeBoundary( boundary, K, ball, lo, up );
+  SurfelAdjacency<3> adj( true );
+  Surface surface( K, ball, adj, *boundary.begin() );
+  KSpace::SCellSet visited;
+  unsigned int nb = 0;
+  for ( auto it = surface.begin(), itE = surface.end(); it != itE; ++it, ++nb )
+    visited.insert( *it );
+  REQUIRE( nb == visited.size() );
+  REQUIRE( visited == boundary );
+  REQUIRE( surface.nbSurfels() == boundary.size() );
+
+  SECTION( "A small surface in a huge space is traversed as quickly" )
+    {
+      KSpace L;
+      L.init( Z3i::Point::diagonal( -1000000 ), Z3i::Point::diagonal( 1000000 ), true );
+      Surface big( L, ball, adj, *boundary.begin() );
+      KSpace::SCellSet big_visited( big.begin(), big.end() );
+      REQUIRE( big_visited == boundary );
+      REQUIRE( big.nbSurfels() == boundary.size() );
+    }
+
+  SECTION( "Concurrent traversals visit each surfel once" )
+    {
+      typedef functors::SurfelSetPredicate<KSpace::SCellSet, KSpace::SCell> SurfelPredicate;
+      typedef LightExplicitDigitalSurface<KSpace, SurfelPredicate> ExplicitSurface;
+      KSpace L;
+      L.init( Z3i::Point::diagonal( -1000000 ), Z3i::Point::diagonal( 1000000 ), true );
+      Surface big( L, ball, adj, *boundary.begin() );
+      SurfelPredicate pred( boundary );
+      ExplicitSurface explicit_surface( K, pred, adj, *boundary.begin() );
+      std::atomic<unsigned int> nb_calls( 0 );
+      auto count = [&nb_calls] ( const KSpace::SCell & ) { ++nb_calls; };
+      Surface::SurfelMarkSet marks( K );
+      surface.traverseConcurrently( marks, count );
+      REQUIRE( nb_calls == boundary.size() );
+      REQUIRE( KSpace::SCellSet( marks.begin(), marks.end() ) == boundary );
+      nb_calls = 0;
+      big.traverseConcurrently( marks, count );
+      REQUIRE( ! marks.isBitmap() );
+      REQUIRE( nb_calls == boundary.size() );
+      REQUIRE( marks.size() == boundary.size() );
+      nb_calls = 0;
+      ExplicitSurface::SurfelMarkSet explicit_marks( K );
+      explicit_surface.traverseConcurrently( explicit_marks, count );
+      REQUIRE( nb_calls == boundary.size() );
+      REQUIRE( KSpace::SCellSet( explicit_marks.begin(), explicit_marks.end() ) == boundary );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////